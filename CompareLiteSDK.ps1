@@ -0,0 +1,70 @@
+# Compares the compile time and the object size of the full SDK with the lite SDK.
+# Run it from a Visual Studio developer command prompt (cl.exe must be in the PATH):
+#   powershell -executionpolicy unrestricted ./CompareLiteSDK.ps1 -SdkPath C:/SDK_GEN/UT4 -IncludePath C:/MyTool
+# The headers the SDK includes (Math/Vector3D.hpp, ...) must be found relative to the SDK or in -IncludePath.
+# The full SDK is measured with all its .cpp files, because a tool which uses it has to compile and link them too.
+
+param(
+	[Parameter(Mandatory = $true)][string]$SdkPath,
+	[string[]]$IncludePath = @(),
+	[int]$Runs = 3,
+	[string]$Compiler = "cl.exe"
+)
+
+$ErrorActionPreference = "Stop"
+
+$SdkPath = (Resolve-Path $SdkPath).Path
+if (!(Test-Path (Join-Path $SdkPath "SDK_Lite.hpp")))
+{
+	throw "$SdkPath contains no SDK_Lite.hpp, generate the SDK with ShouldGenerateLiteSDK()"
+}
+
+$work = Join-Path ([System.IO.Path]::GetTempPath()) "CompareLiteSDK"
+
+function Measure-SDK($name, $header, $sources)
+{
+	$dir = Join-Path $work $name
+	$sample = Join-Path $dir "Sample.cpp"
+
+	$best = [double]::MaxValue
+	for ($run = 0; $run -lt $Runs; ++$run)
+	{
+		if (Test-Path $dir)
+		{
+			Remove-Item $dir -Recurse -Force
+		}
+		New-Item $dir -ItemType Directory | Out-Null
+		Set-Content $sample "#include `"$header`"`r`n`r`nint Sample()`r`n{`r`n`treturn 0;`r`n}`r`n"
+
+		$arguments = @("/nologo", "/c", "/EHsc", "/O2", "/std:c++14", "/I$SdkPath", "/Fo$dir\") + ($IncludePath | ForEach-Object { "/I$_" }) + @($sample) + $sources
+
+		$time = Measure-Command { & $Compiler @arguments | Out-Null }
+		if ($LASTEXITCODE -ne 0)
+		{
+			& $Compiler @arguments
+			throw "$name SDK failed to compile"
+		}
+
+		$best = [Math]::Min($best, $time.TotalSeconds)
+	}
+
+	$bytes = (Get-ChildItem $dir -Filter *.obj | Measure-Object -Property Length -Sum).Sum
+
+	return [PSCustomObject]@{
+		SDK = $name
+		Files = 1 + $sources.Count
+		Seconds = [Math]::Round($best, 2)
+		ObjectBytes = $bytes
+	}
+}
+
+$fullSources = @(Get-ChildItem (Join-Path $SdkPath "SDK") -Filter *.cpp | ForEach-Object { $_.FullName })
+
+$full = Measure-SDK "Full" "SDK.hpp" $fullSources
+$lite = Measure-SDK "Lite" "SDK_Lite.hpp" @()
+
+$full, $lite | Format-Table -AutoSize
+
+Write-Host ("Lite SDK: {0:P0} of the compile time, {1:P0} of the object size (fastest of {2} runs)" -f ($lite.Seconds / [Math]::Max($full.Seconds, 0.01)), ($lite.ObjectBytes / [Math]::Max($full.ObjectBytes, 1)), $Runs)
+
+Remove-Item $work -Recurse -Force
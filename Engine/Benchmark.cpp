@@ -0,0 +1,651 @@
+// Unreal Engine SDK Generator
+// by KN4CK3R
+// https://www.oldschoolhack.me
+
+#include <windows.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <malloc.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <new>
+#include <string>
+#include <vector>
+#include <unordered_set>
+#include <unordered_map>
+#include <filesystem>
+namespace fs = std::experimental::filesystem;
+
+#include "Logger.hpp"
+
+#include "IGenerator.hpp"
+#include "ObjectsStore.hpp"
+#include "NamesStore.hpp"
+#include "Package.hpp"
+#include "NameValidator.hpp"
+#include "PatternFinder.hpp"
+#include "SyntheticUniverse.hpp"
+#include "JsonWriter.hpp"
+#include "JsonReader.hpp"
+#include "Utf8.hpp"
+
+extern IGenerator* generator;
+
+void ProcessPackages(const fs::path& path);
+
+namespace
+{
+	std::atomic<uint64_t> allocationCount(0);
+	//bytes allocated with new and not deleted yet and the maximum since the last reset
+	std::atomic<int64_t> heapBytes(0);
+	std::atomic<int64_t> peakHeapBytes(0);
+}
+
+//every allocation of the process is counted, the kernels report the difference
+void* operator new(size_t size)
+{
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	if (auto memory = std::malloc(size != 0 ? size : 1))
+	{
+		auto allocated = static_cast<int64_t>(_msize(memory));
+		auto bytes = heapBytes.fetch_add(allocated, std::memory_order_relaxed) + allocated;
+		auto peak = peakHeapBytes.load(std::memory_order_relaxed);
+		while (peak < bytes && !peakHeapBytes.compare_exchange_weak(peak, bytes, std::memory_order_relaxed))
+		{
+		}
+		return memory;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+	if (memory != nullptr)
+	{
+		heapBytes.fetch_sub(_msize(memory), std::memory_order_relaxed);
+	}
+	std::free(memory);
+}
+
+namespace
+{
+	struct Result
+	{
+		std::string Name;
+		uint64_t Objects;
+		uint64_t WallMicroseconds;
+		uint64_t Allocations;
+		/// <summary>
+		/// The maximum number of heap bytes the kernel allocated on top of the heap size at its start.
+		/// </summary>
+		uint64_t PeakHeapBytes;
+	};
+
+	/// <summary>
+	/// Results of the kernels are added to this value so the compiler can not remove the work.
+	/// </summary>
+	volatile size_t sink = 0;
+
+	/// <summary>
+	/// Prints a line to the console and adds it to the log.
+	/// </summary>
+	template<typename... Args>
+	void Report(const char* fmt, const Args&... args)
+	{
+		auto message = tfm::format(fmt, args...);
+		std::cout << message << std::endl;
+		Logger::Log(message);
+	}
+
+	/// <summary>
+	/// Runs a kernel multiple times and keeps the fastest run.
+	/// </summary>
+	/// <param name="kernel">The name of the kernel.</param>
+	/// <param name="objectCount">The number of objects in the universe.</param>
+	/// <param name="iterations">The number of runs.</param>
+	/// <param name="function">The kernel.</param>
+	/// <returns>The measured values.</returns>
+	template<typename Function>
+	Result Run(const std::string& kernel, size_t objectCount, size_t iterations, Function function)
+	{
+		using namespace std::chrono;
+
+		Result result = { kernel + "/" + std::to_string(objectCount), objectCount, UINT64_MAX, UINT64_MAX, UINT64_MAX };
+
+		for (auto i = 0u; i < (std::max)(iterations, static_cast<size_t>(1)); ++i)
+		{
+			auto allocationsBefore = allocationCount.load();
+			auto heapBefore = heapBytes.load();
+			peakHeapBytes = heapBefore;
+			auto begin = steady_clock::now();
+
+			function();
+
+			uint64_t wall = duration_cast<microseconds>(steady_clock::now() - begin).count();
+
+			result.WallMicroseconds = (std::min)(result.WallMicroseconds, wall);
+			result.Allocations = (std::min)(result.Allocations, allocationCount.load() - allocationsBefore);
+			result.PeakHeapBytes = (std::min)(result.PeakHeapBytes, static_cast<uint64_t>(peakHeapBytes.load() - heapBefore));
+		}
+
+		Report("%-28s %12d us %12d allocations %8d KB peak heap", result.Name, result.WallMicroseconds, result.Allocations, result.PeakHeapBytes / 1024);
+
+		return result;
+	}
+
+	/// <summary>
+	/// Builds a synthetic universe and runs all kernels on it.
+	/// </summary>
+	/// <param name="objectCount">The number of objects in the universe.</param>
+	/// <param name="iterations">The number of runs of every kernel.</param>
+	/// <param name="outputDirectory">The directory the pipeline writes to.</param>
+	/// <param name="results">[out] The results.</param>
+	/// <returns>true if it succeeds, false if the universe could not be installed.</returns>
+	bool RunScale(size_t objectCount, size_t iterations, const fs::path& outputDirectory, std::vector<Result>& results)
+	{
+		SyntheticUniverse::Options options;
+		options.ObjectCount = objectCount;
+
+		if (!SyntheticUniverse(options).Install())
+		{
+			Report("Failed to install a synthetic universe with %d objects", objectCount);
+			return false;
+		}
+
+		std::vector<UEObject> objects;
+		std::vector<UEProperty> properties;
+		std::vector<UEFunction> functions;
+		std::vector<UEObject> packages;
+		std::vector<std::string> classNames;
+		std::unordered_set<UEObject> uniquePackages;
+
+		for (auto&& info : ObjectsStore())
+		{
+			auto obj = info.Object;
+			objects.push_back(obj);
+
+			if (obj.IsA<UEProperty>())
+			{
+				properties.push_back(obj.Cast<UEProperty>());
+			}
+			else if (obj.IsA<UEFunction>())
+			{
+				functions.push_back(obj.Cast<UEFunction>());
+			}
+			else if (obj.IsA<UEClass>())
+			{
+				classNames.push_back(obj.GetFullName());
+			}
+
+			auto package = obj.GetPackageObject();
+			if (package.IsValid() && uniquePackages.insert(package).second)
+			{
+				packages.push_back(package);
+			}
+		}
+
+		//a fixed block of pseudo random bytes with the pattern at the end
+		std::vector<unsigned char> memory(64 * 1024 * 1024);
+		uint32_t state = 1;
+		for (auto&& byte : memory)
+		{
+			state = state * 1664525 + 1013904223;
+			byte = static_cast<unsigned char>(state >> 24);
+		}
+		const unsigned char pattern[] = "\x48\x8B\x1D\x00\x00\x00\x00\x48\x85\xDB\x75\x35";
+		const char* mask = "xxx????xxxxx";
+		std::copy(std::begin(pattern), std::end(pattern) - 1, std::end(memory) - sizeof(pattern));
+
+		results.push_back(Run("FindPattern", objectCount, iterations, [&]()
+		{
+			sink += FindPattern(reinterpret_cast<uintptr_t>(memory.data()), memory.size(), pattern, mask);
+		}));
+
+		results.push_back(Run("GetFullName", objectCount, iterations, [&]()
+		{
+			for (auto&& obj : objects)
+			{
+				sink += obj.GetFullName().length();
+			}
+		}));
+
+		results.push_back(Run("GetInfo", objectCount, iterations, [&]()
+		{
+			for (auto&& property : properties)
+			{
+				sink += property.GetInfo().Size;
+			}
+		}));
+
+		results.push_back(Run("StringifyFlags", objectCount, iterations, [&]()
+		{
+			for (auto&& property : properties)
+			{
+				sink += StringifyFlags(property.GetPropertyFlags()).length();
+			}
+			for (auto&& function : functions)
+			{
+				sink += StringifyFlags(function.GetFunctionFlags()).length();
+			}
+		}));
+
+		results.push_back(Run("MakeValidName", objectCount, iterations, [&]()
+		{
+			for (auto&& name : NamesStore())
+			{
+				sink += MakeValidName(std::string(name.Name.c_str(), name.Name.size())).length();
+			}
+		}));
+
+		//names with ASCII only, Latin-1, CJK and surrogate pair (emoji) blocks, every block type takes a different path of the converter
+		std::vector<std::wstring> utf16Names;
+		for (auto i = 0u; i < 4096; ++i)
+		{
+			std::wstring name = L"Name_" + std::to_wstring(i);
+			for (auto j = 0u; j < 4; ++j)
+			{
+				switch ((i + j) % 4)
+				{
+					case 0: name += L"PlayerController"; break;
+					case 1: name += L"Gr\u00F6\u00DFe_\u00E9t\u00E9"; break;
+					case 2: name += L"\u6B66\u5668\u30C7\u30FC\u30BF"; break;
+					case 3: name += std::wstring{ 0xD83D, 0xDE00, L'_', 0xD83C, 0xDFAE }; break;
+				}
+			}
+			utf16Names.push_back(std::move(name));
+		}
+
+		results.push_back(Run("Utf16ToUtf8", objectCount, iterations, [&]()
+		{
+			for (auto&& name : utf16Names)
+			{
+				sink += Utf16ToUtf8(name.data(), name.length()).length();
+			}
+		}));
+
+		//FindClass scans the whole table, a few samples from all over the table are enough
+		std::vector<std::string> sampledClassNames;
+		for (auto i = 0u; i < 16 && !classNames.empty(); ++i)
+		{
+			sampledClassNames.push_back(classNames[i * classNames.size() / 16]);
+		}
+
+		results.push_back(Run("FindClass", objectCount, iterations, [&]()
+		{
+			ObjectsStore store;
+			for (auto&& name : sampledClassNames)
+			{
+				sink += store.FindClass(name).IsValid();
+			}
+		}));
+
+		//processes and formats every package in memory, the part of ProcessPackages without the file output
+		results.push_back(Run("ProcessAndFormat", objectCount, iterations, [&]()
+		{
+			std::vector<UEObject> packageOrder;
+			std::unordered_map<UEObject, bool> definedClasses;
+
+			for (auto&& packageObj : packages)
+			{
+				Package package(packageObj, packageOrder, definedClasses);
+				package.Process();
+
+				std::vector<Package::File> files;
+				package.Format(outputDirectory / "SDK", files);
+				sink += files.size();
+			}
+		}));
+
+		results.push_back(Run("ProcessPackages", objectCount, iterations, [&]()
+		{
+			ProcessPackages(outputDirectory / ("Universe" + std::to_string(objectCount)));
+		}));
+
+		return true;
+	}
+
+	bool SaveResults(const fs::path& file, const std::vector<Result>& results)
+	{
+		std::ofstream os(file);
+		if (!os)
+		{
+			return false;
+		}
+
+		JsonWriter writer(os);
+		writer.BeginObject();
+		writer.Key("Benchmarks");
+		writer.BeginArray();
+		for (auto&& result : results)
+		{
+			writer.BeginObject();
+			writer.Key("Name");
+			writer.String(result.Name);
+			writer.Key("Objects");
+			writer.Number(result.Objects);
+			writer.Key("WallMicroseconds");
+			writer.Number(result.WallMicroseconds);
+			writer.Key("Allocations");
+			writer.Number(result.Allocations);
+			writer.Key("PeakHeapBytes");
+			writer.Number(result.PeakHeapBytes);
+			writer.EndObject();
+		}
+		writer.EndArray();
+		writer.EndObject();
+		os << '\n';
+
+		return static_cast<bool>(os);
+	}
+
+	bool LoadResults(const fs::path& file, std::vector<Result>& results)
+	{
+		std::ifstream is(file);
+		if (!is)
+		{
+			return false;
+		}
+
+		std::stringstream ss;
+		ss << is.rdbuf();
+
+		JsonValue root;
+		if (!JsonReader::Parse(ss.str(), root))
+		{
+			return false;
+		}
+
+		auto benchmarks = root.Find("Benchmarks");
+		if (benchmarks == nullptr || benchmarks->GetType() != JsonValue::Type::Array)
+		{
+			return false;
+		}
+
+		for (auto&& benchmark : benchmarks->GetArray())
+		{
+			auto name = benchmark.Find("Name");
+			auto objects = benchmark.Find("Objects");
+			auto wall = benchmark.Find("WallMicroseconds");
+			auto allocations = benchmark.Find("Allocations");
+			auto peak = benchmark.Find("PeakHeapBytes");
+			if (name == nullptr || objects == nullptr || wall == nullptr || allocations == nullptr || peak == nullptr)
+			{
+				return false;
+			}
+
+			results.push_back({
+				name->GetString(),
+				static_cast<uint64_t>(objects->GetNumber()),
+				static_cast<uint64_t>(wall->GetNumber()),
+				static_cast<uint64_t>(allocations->GetNumber()),
+				static_cast<uint64_t>(peak->GetNumber())
+			});
+		}
+
+		return true;
+	}
+
+	/// <summary>
+	/// Compares the results with the baseline and logs every metric which got worse than the threshold allows.
+	/// Wall time differences below one millisecond are ignored because they are just noise.
+	/// </summary>
+	/// <param name="results">The results.</param>
+	/// <param name="baseline">The baseline.</param>
+	/// <param name="threshold">The allowed regression in percent.</param>
+	/// <returns>The number of regressions.</returns>
+	size_t CompareWithBaseline(const std::vector<Result>& results, const std::vector<Result>& baseline, double threshold)
+	{
+		std::unordered_map<std::string, const Result*> baselineByName;
+		for (auto&& result : baseline)
+		{
+			baselineByName[result.Name] = &result;
+		}
+
+		size_t regressions = 0;
+
+		auto check = [&](const std::string& name, const char* metric, uint64_t value, uint64_t baseValue, uint64_t noise)
+		{
+			auto change = baseValue != 0 ? (static_cast<double>(value) / baseValue - 1.0) * 100.0 : 0.0;
+			if (value > baseValue + noise && change > threshold)
+			{
+				Report("%-28s %s regressed from %d to %d (+%.1f%%)", name, metric, baseValue, value, change);
+				++regressions;
+			}
+		};
+
+		for (auto&& result : results)
+		{
+			auto it = baselineByName.find(result.Name);
+			if (it == std::end(baselineByName))
+			{
+				Report("%-28s not in the baseline", result.Name);
+				continue;
+			}
+
+			auto& base = *it->second;
+			check(result.Name, "wall time", result.WallMicroseconds, base.WallMicroseconds, 1000);
+			check(result.Name, "allocations", result.Allocations, base.Allocations, 0);
+			check(result.Name, "peak heap", result.PeakHeapBytes, base.PeakHeapBytes, 0);
+		}
+
+		return regressions;
+	}
+
+	/// <summary>
+	/// Runs a child process and waits until it exits.
+	/// </summary>
+	/// <param name="commandLine">The command line.</param>
+	/// <returns>The exit code of the process or -1 if it could not be started.</returns>
+	int RunProcess(std::string commandLine)
+	{
+		STARTUPINFOA startupInfo = {};
+		startupInfo.cb = sizeof(startupInfo);
+		PROCESS_INFORMATION processInfo = {};
+
+		if (!CreateProcessA(nullptr, &commandLine[0], nullptr, nullptr, FALSE, 0, nullptr, nullptr, &startupInfo, &processInfo))
+		{
+			return -1;
+		}
+
+		WaitForSingleObject(processInfo.hProcess, INFINITE);
+
+		DWORD exitCode = static_cast<DWORD>(-1);
+		GetExitCodeProcess(processInfo.hProcess, &exitCode);
+
+		CloseHandle(processInfo.hThread);
+		CloseHandle(processInfo.hProcess);
+
+		return static_cast<int>(exitCode);
+	}
+
+	void PrintUsage()
+	{
+		std::cout << "Usage: Benchmark [options]\n"
+			"  --objects <n,n,...>   object counts of the synthetic universes (default: 10000,100000)\n"
+			"  --iterations <n>      runs per kernel, the fastest run is reported (default: 3)\n"
+			"  --output <dir>        directory for the generated files and the results (default: Benchmark)\n"
+			"  --results <file>      results file (default: <output>/BenchmarkResults.json)\n"
+			"  --baseline <file>     baseline to compare with, the run fails if it does not exist\n"
+			"  --save-baseline <file> saves the results as new baseline\n"
+			"  --threshold <percent> allowed regression before the run fails (default: 10)\n";
+	}
+}
+
+/// <summary>
+/// Runs the generator kernels and the complete pipeline on synthetic universes.
+/// Every scale runs in its own process because the engine types cache the core classes.
+/// Returns 0 on success, 1 if a regression was found and 2 on errors.
+/// </summary>
+int main(int argc, char* argv[])
+{
+	std::vector<size_t> scales = { 10000, 100000 };
+	size_t iterations = 3;
+	double threshold = 10.0;
+	fs::path outputDirectory = "Benchmark";
+	fs::path resultsFile;
+	fs::path baselineFile;
+	fs::path saveBaselineFile;
+
+	for (auto i = 1; i < argc; ++i)
+	{
+		std::string argument = argv[i];
+		if (i + 1 == argc)
+		{
+			PrintUsage();
+			return 2;
+		}
+		std::string value = argv[++i];
+
+		if (argument == "--objects")
+		{
+			scales.clear();
+
+			std::stringstream ss(value);
+			std::string scale;
+			while (std::getline(ss, scale, ','))
+			{
+				scales.push_back(std::strtoull(scale.c_str(), nullptr, 10));
+			}
+		}
+		else if (argument == "--iterations")
+		{
+			iterations = std::strtoull(value.c_str(), nullptr, 10);
+		}
+		else if (argument == "--output")
+		{
+			outputDirectory = value;
+		}
+		else if (argument == "--results")
+		{
+			resultsFile = value;
+		}
+		else if (argument == "--baseline")
+		{
+			baselineFile = value;
+		}
+		else if (argument == "--save-baseline")
+		{
+			saveBaselineFile = value;
+		}
+		else if (argument == "--threshold")
+		{
+			threshold = std::strtod(value.c_str(), nullptr);
+		}
+		else
+		{
+			PrintUsage();
+			return 2;
+		}
+	}
+
+	if (scales.empty())
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	if (resultsFile.empty())
+	{
+		resultsFile = outputDirectory / "BenchmarkResults.json";
+	}
+
+	fs::create_directories(outputDirectory);
+
+	auto exitCode = 0;
+
+	std::vector<Result> results;
+	if (scales.size() == 1)
+	{
+		//the log of the generator is too long for the console
+		std::ofstream log(outputDirectory / tfm::format("Benchmark_%d.log", scales.front()));
+		Logger::SetStream(&log);
+
+		if (!generator->Initialize(nullptr) || !RunScale(scales.front(), iterations, outputDirectory, results))
+		{
+			exitCode = 2;
+		}
+
+		Logger::SetStream(nullptr);
+	}
+	else
+	{
+		char buffer[2048];
+		if (GetModuleFileNameA(nullptr, buffer, sizeof(buffer)) == 0)
+		{
+			Report("GetModuleFileName failed");
+			exitCode = 2;
+		}
+
+		for (auto it = std::begin(scales); exitCode == 0 && it != std::end(scales); ++it)
+		{
+			auto scaleResultsFile = outputDirectory / tfm::format("BenchmarkResults_%d.json", *it);
+
+			auto commandLine = tfm::format("\"%s\" --objects %d --iterations %d --output \"%s\" --results \"%s\"", buffer, *it, iterations, outputDirectory.string(), scaleResultsFile.string());
+
+			auto childExitCode = RunProcess(commandLine);
+
+			if (childExitCode != 0 || !LoadResults(scaleResultsFile, results))
+			{
+				Report("The benchmark with %d objects failed", *it);
+				exitCode = 2;
+			}
+		}
+	}
+
+	if (exitCode == 0 && !SaveResults(resultsFile, results))
+	{
+		Report("Failed to save the results to %s", resultsFile.string());
+		exitCode = 2;
+	}
+
+	if (exitCode == 0 && !saveBaselineFile.empty())
+	{
+		if (SaveResults(saveBaselineFile, results))
+		{
+			Report("Saved the baseline %s", saveBaselineFile.string());
+		}
+		else
+		{
+			Report("Failed to save the baseline %s", saveBaselineFile.string());
+			exitCode = 2;
+		}
+	}
+
+	if (exitCode == 0 && !baselineFile.empty())
+	{
+		//a missing baseline is an error, else a CI run with a wrong path would always pass
+		if (!fs::exists(baselineFile))
+		{
+			Report("The baseline %s does not exist, create it with --save-baseline", baselineFile.string());
+			exitCode = 2;
+		}
+		else
+		{
+			std::vector<Result> baseline;
+			if (!LoadResults(baselineFile, baseline))
+			{
+				Report("Failed to load the baseline %s", baselineFile.string());
+				exitCode = 2;
+			}
+			else
+			{
+				auto regressions = CompareWithBaseline(results, baseline, threshold);
+				if (regressions != 0)
+				{
+					Report("%d regressions above %.1f%%", regressions, threshold);
+					exitCode = 1;
+				}
+				else
+				{
+					Report("No regressions above %.1f%%", threshold);
+				}
+			}
+		}
+	}
+
+	return exitCode;
+}
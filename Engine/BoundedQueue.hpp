@@ -0,0 +1,122 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+/// <summary>
+/// A thread safe queue with a fixed capacity.
+/// Push blocks while the queue is full and Pop blocks while the queue is empty.
+/// </summary>
+/// <typeparam name="T">Type of the items.</typeparam>
+template<typename T>
+class BoundedQueue
+{
+public:
+	/// <summary>
+	/// Constructor.
+	/// </summary>
+	/// <param name="capacity">The maximum number of items in the queue.</param>
+	explicit BoundedQueue(size_t capacity)
+		: capacity(capacity == 0 ? 1 : capacity),
+		  closed(false),
+		  maxDepth(0),
+		  depthSum(0),
+		  pushCount(0)
+	{
+	}
+
+	/// <summary>
+	/// Adds an item to the queue. Blocks while the queue is full.
+	/// </summary>
+	/// <param name="item">The item.</param>
+	void Push(T&& item)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		notFull.wait(lock, [this]() { return items.size() < capacity; });
+
+		items.push_back(std::move(item));
+
+		if (items.size() > maxDepth)
+		{
+			maxDepth = items.size();
+		}
+		depthSum += items.size();
+		++pushCount;
+
+		notEmpty.notify_one();
+	}
+
+	/// <summary>
+	/// Removes the first item of the queue. Blocks while the queue is empty and not closed.
+	/// </summary>
+	/// <param name="item">[out] The item.</param>
+	/// <returns>false if the queue is closed and empty, else true.</returns>
+	bool Pop(T& item)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		notEmpty.wait(lock, [this]() { return !items.empty() || closed; });
+
+		if (items.empty())
+		{
+			return false;
+		}
+
+		item = std::move(items.front());
+		items.pop_front();
+
+		notFull.notify_one();
+
+		return true;
+	}
+
+	/// <summary>
+	/// Closes the queue. Pop returns false after the remaining items are removed.
+	/// </summary>
+	void Close()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		closed = true;
+
+		notEmpty.notify_all();
+	}
+
+	/// <summary>
+	/// Gets the maximum number of items which were in the queue at the same time.
+	/// </summary>
+	/// <returns>The maximum depth.</returns>
+	size_t GetMaxDepth() const
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		return maxDepth;
+	}
+
+	/// <summary>
+	/// Gets the average number of items in the queue after a push.
+	/// </summary>
+	/// <returns>The average depth.</returns>
+	double GetAverageDepth() const
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		return pushCount == 0 ? 0.0 : static_cast<double>(depthSum) / pushCount;
+	}
+
+private:
+	const size_t capacity;
+	bool closed;
+
+	std::deque<T> items;
+
+	mutable std::mutex mutex;
+	std::condition_variable notFull;
+	std::condition_variable notEmpty;
+
+	size_t maxDepth;
+	size_t depthSum;
+	size_t pushCount;
+};
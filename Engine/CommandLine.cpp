@@ -0,0 +1,283 @@
+// Unreal Engine SDK Generator
+// by KN4CK3R
+// https://www.oldschoolhack.me
+
+#include <windows.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include <filesystem>
+namespace fs = std::experimental::filesystem;
+
+#include "tinyformat.h"
+
+#include "IGenerator.hpp"
+#include "GeneratorOverrides.hpp"
+#include "Driver.hpp"
+#include "ReflectionDiff.hpp"
+
+extern IGenerator* generator;
+
+namespace
+{
+	void PrintUsage()
+	{
+		std::cout << "Usage: Generator [options]\n"
+			"  --source <source>          synthetic[:objects[:seed]] or snapshot:<file> (default: synthetic:10000)\n"
+			"  --output <dir>             output directory, the short game name gets appended\n"
+			"  --threads <n>              worker threads of the dumps, 0 = one per hardware thread\n"
+			"  --queue-capacity <n>       capacity of the pipeline queues\n"
+			"  --unity <n>                number of unity build units, 0 = no unity build\n"
+			"  --[no-]dump                dump the object and name arrays\n"
+			"  --[no-]snapshot            copy the object pointers and the names before generating\n"
+			"  --[no-]snapshot-file       save the objects as snapshot file for --source snapshot:<file>\n"
+			"  --[no-]lite                generate the lite SDK\n"
+			"  --[no-]header-per-class    generate one header per struct and class\n"
+			"  --[no-]offset-table        generate the runtime offset table of the lite SDK\n"
+			"  --[no-]stream              stream the packages to disk\n"
+			"  --[no-]json                generate the JSON files\n"
+			"  --[no-]database            generate the reflection database\n"
+			"  --[no-]timings             write the timing summary and the trace file (default: on)\n"
+			"  --diff <old.db> <new.db>   compare two reflection databases instead of generating,\n"
+			"                             writes ReflectionDiff.txt and ReflectionDiff.json to the output directory\n"
+			"Exit codes: 0 = success, 1 = invalid arguments, 2 = source failed, 3 = initialize failed, 4 = output failed\n";
+	}
+
+	/// <summary>
+	/// Creates the memory source from the value of the --source flag.
+	/// </summary>
+	/// <param name="value">The value.</param>
+	/// <returns>The memory source or nullptr if the value is invalid.</returns>
+	std::unique_ptr<IMemorySource> CreateMemorySource(const std::string& value)
+	{
+		const std::string synthetic = "synthetic";
+		const std::string snapshot = "snapshot:";
+
+		if (value.compare(0, synthetic.length(), synthetic) == 0)
+		{
+			SyntheticUniverse::Options options;
+			if (value.length() > synthetic.length())
+			{
+				if (value[synthetic.length()] != ':')
+				{
+					return nullptr;
+				}
+				char* end;
+				options.ObjectCount = std::strtoull(value.c_str() + synthetic.length() + 1, &end, 10);
+				if (*end == ':')
+				{
+					options.Seed = static_cast<uint32_t>(std::strtoul(end + 1, nullptr, 10));
+				}
+			}
+			return std::make_unique<SyntheticMemorySource>(options);
+		}
+
+		if (value.compare(0, snapshot.length(), snapshot) == 0 && value.length() > snapshot.length())
+		{
+			return std::make_unique<SnapshotMemorySource>(value.substr(snapshot.length()));
+		}
+
+		//reading another process is not possible because the stores dereference the engine objects directly,
+		//the live game is used by injecting the DLL
+		return nullptr;
+	}
+
+	bool LoadFile(const std::string& file, std::vector<char>& data)
+	{
+		std::ifstream is(file, std::ios::binary);
+		if (!is)
+		{
+			return false;
+		}
+		data.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+		return true;
+	}
+
+	/// <summary>
+	/// Compares two reflection databases and writes the report and the patch list.
+	/// </summary>
+	/// <param name="oldFile">The database of the old build.</param>
+	/// <param name="newFile">The database of the new build.</param>
+	/// <param name="directory">The directory for the report and the patch list.</param>
+	/// <returns>The exit code.</returns>
+	ExitCode RunDiff(const std::string& oldFile, const std::string& newFile, const fs::path& directory)
+	{
+		std::vector<char> oldData;
+		std::vector<char> newData;
+		ReflectionDatabaseReader oldDatabase;
+		ReflectionDatabaseReader newDatabase;
+		if (!LoadFile(oldFile, oldData) || !oldDatabase.Open(oldData.data(), oldData.size()))
+		{
+			std::cerr << "Invalid reflection database: " << oldFile << "\n";
+			return ExitCode::SourceFailed;
+		}
+		if (!LoadFile(newFile, newData) || !newDatabase.Open(newData.data(), newData.size()))
+		{
+			std::cerr << "Invalid reflection database: " << newFile << "\n";
+			return ExitCode::SourceFailed;
+		}
+
+		auto begin = std::chrono::steady_clock::now();
+
+		ReflectionDiff diff;
+		diff.Compare(oldDatabase, newDatabase);
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin).count();
+
+		std::error_code error;
+		fs::create_directories(directory, error);
+
+		std::ofstream report(directory / "ReflectionDiff.txt");
+		std::ofstream patchList(directory / "ReflectionDiff.json");
+		if (!report || !patchList)
+		{
+			std::cerr << GetExitCodeMessage(ExitCode::OutputFailed) << "\n";
+			return ExitCode::OutputFailed;
+		}
+
+		diff.WriteReport(report);
+		diff.WritePatchList(patchList);
+
+		std::cout << tfm::format("%d changes between %d and %d structs found in %d ms\n", diff.GetChanges().size(), oldDatabase.GetStructCount(), newDatabase.GetStructCount(), elapsed);
+
+		return ExitCode::Success;
+	}
+}
+
+/// <summary>
+/// Runs the generator without a game, for example on a build server.
+/// The settings of the compiled-in generator can be overridden with flags, errors are reported with exit codes.
+/// </summary>
+int main(int argc, char* argv[])
+{
+	GeneratorOverrides overrides(*generator);
+
+	std::string sourceName = "synthetic:10000";
+	auto writeTimings = true;
+	std::string diffOld;
+	std::string diffNew;
+
+	struct Switch
+	{
+		const char* Name;
+		GeneratorOverrides::Override<bool>* Value;
+	};
+	const Switch switches[] = {
+		{ "dump", &overrides.DumpArrays },
+		{ "snapshot", &overrides.CaptureSnapshot },
+		{ "snapshot-file", &overrides.SaveSnapshotFile },
+		{ "lite", &overrides.GenerateLiteSDK },
+		{ "header-per-class", &overrides.GenerateHeaderPerClass },
+		{ "offset-table", &overrides.GenerateOffsetTable },
+		{ "stream", &overrides.StreamPackages },
+		{ "json", &overrides.GenerateJson },
+		{ "database", &overrides.GenerateReflectionDatabase }
+	};
+
+	for (auto i = 1; i < argc; ++i)
+	{
+		std::string argument = argv[i];
+
+		if (argument == "--timings" || argument == "--no-timings")
+		{
+			writeTimings = argument == "--timings";
+			continue;
+		}
+
+		if (argument == "--diff")
+		{
+			if (i + 2 >= argc)
+			{
+				PrintUsage();
+				return static_cast<int>(ExitCode::InvalidArguments);
+			}
+			diffOld = argv[++i];
+			diffNew = argv[++i];
+			continue;
+		}
+
+		auto isSwitch = false;
+		for (auto&& s : switches)
+		{
+			if (argument == tfm::format("--%s", s.Name) || argument == tfm::format("--no-%s", s.Name))
+			{
+				s.Value->Set(argument.compare(0, 5, "--no-") != 0);
+				isSwitch = true;
+				break;
+			}
+		}
+		if (isSwitch)
+		{
+			continue;
+		}
+
+		if (i + 1 == argc)
+		{
+			PrintUsage();
+			return static_cast<int>(ExitCode::InvalidArguments);
+		}
+		std::string value = argv[++i];
+
+		if (argument == "--source")
+		{
+			sourceName = value;
+		}
+		else if (argument == "--output")
+		{
+			overrides.OutputDirectory.Set(value);
+		}
+		else if (argument == "--threads")
+		{
+			overrides.ThreadCount.Set(std::strtoull(value.c_str(), nullptr, 10));
+		}
+		else if (argument == "--queue-capacity")
+		{
+			overrides.PipelineQueueCapacity.Set((std::max)(std::strtoull(value.c_str(), nullptr, 10), 1ull));
+		}
+		else if (argument == "--unity")
+		{
+			overrides.UnityBuildUnitCount.Set(std::strtoull(value.c_str(), nullptr, 10));
+		}
+		else
+		{
+			PrintUsage();
+			return static_cast<int>(ExitCode::InvalidArguments);
+		}
+	}
+
+	if (!diffOld.empty())
+	{
+		return static_cast<int>(RunDiff(diffOld, diffNew, overrides.OutputDirectory.Get(".")));
+	}
+
+	auto source = CreateMemorySource(sourceName);
+	if (!source)
+	{
+		std::cerr << "Unknown source: " << sourceName << "\n";
+		PrintUsage();
+		return static_cast<int>(ExitCode::InvalidArguments);
+	}
+
+	//all engine code reads the settings through the global generator
+	generator = &overrides;
+
+	auto begin = std::chrono::steady_clock::now();
+
+	auto result = Generate(*source, nullptr, writeTimings);
+	if (result != ExitCode::Success)
+	{
+		std::cerr << GetExitCodeMessage(result) << "\n";
+	}
+	else
+	{
+		std::cout << tfm::format("Generated %s from %s in %d ms\n", overrides.GetGameNameShort(), source->GetName(), std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin).count());
+	}
+
+	return static_cast<int>(result);
+}
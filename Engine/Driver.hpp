@@ -0,0 +1,33 @@
+#pragma once
+
+#include "MemorySource.hpp"
+
+/// <summary>
+/// The result of a generator run. The values are the exit codes of the command line driver.
+/// </summary>
+enum class ExitCode
+{
+	Success = 0,
+	InvalidArguments = 1,
+	SourceFailed = 2,
+	InitializeFailed = 3,
+	/// <summary>The output directory could not be created or an output file (reflection database, offset table, snapshot file, trace) could not be saved.</summary>
+	OutputFailed = 4
+};
+
+/// <summary>
+/// Gets a description of the exit code.
+/// </summary>
+/// <param name="code">The exit code.</param>
+/// <returns>The description.</returns>
+const char* GetExitCodeMessage(ExitCode code);
+
+/// <summary>
+/// Runs the complete generation: installs the memory source, initializes the generator, dumps the arrays and generates the SDK.
+/// The files are written to the output directory of the generator (<see cref="IGenerator::GetOutputDirectory()" />) and the short game name.
+/// </summary>
+/// <param name="source">The source of the objects and names.</param>
+/// <param name="module">The module handle which gets passed to <see cref="IGenerator::Initialize()" />. A relative output directory is relative to this module or to the current directory if the module is nullptr.</param>
+/// <param name="writeTimings">true to log the timing summary and to write the trace file.</param>
+/// <returns>The exit code.</returns>
+ExitCode Generate(IMemorySource& source, void* module, bool writeTimings);
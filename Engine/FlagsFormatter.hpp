@@ -0,0 +1,116 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <initializer_list>
+#include <utility>
+#include <mutex>
+#include <cstdint>
+#include <type_traits>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/// <summary>
+/// Gets the index of the lowest set bit.
+/// </summary>
+/// <param name="value">The value. Must not be 0.</param>
+/// <returns>The number of trailing zero bits.</returns>
+inline unsigned long CountTrailingZeros(uint64_t value)
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	//_BitScanForward64 is not available in 32 bit builds
+	if (_BitScanForward(&index, static_cast<unsigned long>(value)))
+	{
+		return index;
+	}
+	_BitScanForward(&index, static_cast<unsigned long>(value >> 32));
+	return index + 32;
+#else
+	return static_cast<unsigned long>(__builtin_ctzll(value));
+#endif
+}
+
+/// <summary>
+/// Converts flag values into strings ("FLAG_A, FLAG_B").
+/// Every flag value gets formatted only once, later calls return the cached string.
+/// </summary>
+/// <typeparam name="T">The flags enum. Every flag must be a single bit.</typeparam>
+template<typename T>
+class FlagsFormatter
+{
+	using UnderlyingType = std::underlying_type_t<T>;
+
+public:
+	/// <summary>
+	/// Constructor.
+	/// </summary>
+	/// <param name="flags">The names of the flags.</param>
+	FlagsFormatter(std::initializer_list<std::pair<T, const char*>> flags)
+	{
+		for (auto&& name : names)
+		{
+			name = nullptr;
+		}
+		for (auto&& flag : flags)
+		{
+			names[CountTrailingZeros(static_cast<UnderlyingType>(flag.first))] = flag.second;
+		}
+	}
+
+	/// <summary>
+	/// Gets the string representation of the flags.
+	/// </summary>
+	/// <param name="flags">The flags.</param>
+	/// <returns>The string representation of the flags.</returns>
+	const std::string& Format(T flags)
+	{
+		auto value = static_cast<UnderlyingType>(flags);
+
+		std::lock_guard<std::mutex> lock(mutex);
+
+		auto it = cache.find(value);
+		if (it != std::end(cache))
+		{
+			return it->second;
+		}
+
+		return cache.emplace(value, FormatUncached(value)).first->second;
+	}
+
+private:
+	/// <summary>
+	/// Builds the string representation by visiting the set bits from the lowest to the highest bit.
+	/// </summary>
+	/// <param name="value">The flags.</param>
+	/// <returns>The string representation of the flags.</returns>
+	std::string FormatUncached(UnderlyingType value) const
+	{
+		std::string str;
+
+		uint64_t bits = value;
+		while (bits != 0)
+		{
+			auto name = names[CountTrailingZeros(bits)];
+			if (name != nullptr)
+			{
+				if (!str.empty())
+				{
+					str += ", ";
+				}
+				str += name;
+			}
+
+			//clear the lowest set bit
+			bits &= bits - 1;
+		}
+
+		return str;
+	}
+
+	const char* names[sizeof(UnderlyingType) * 8];
+
+	std::unordered_map<UnderlyingType, std::string> cache;
+	std::mutex mutex;
+};
@@ -0,0 +1,226 @@
+#pragma once
+
+#include "IGenerator.hpp"
+
+/// <summary>
+/// Wraps the compiled-in generator and replaces some of its settings, for example with the values of command line flags.
+/// Every setting which is not overridden is forwarded to the wrapped generator.
+/// </summary>
+class GeneratorOverrides : public IGenerator
+{
+public:
+	template<typename T>
+	struct Override
+	{
+		bool IsSet;
+		T Value;
+
+		Override()
+			: IsSet(false),
+			  Value()
+		{
+		}
+
+		void Set(const T& value)
+		{
+			IsSet = true;
+			Value = value;
+		}
+
+		T Get(const T& fallback) const
+		{
+			return IsSet ? Value : fallback;
+		}
+	};
+
+	Override<std::string> OutputDirectory;
+	Override<bool> DumpArrays;
+	Override<bool> CaptureSnapshot;
+	Override<bool> SaveSnapshotFile;
+	Override<bool> GenerateLiteSDK;
+	Override<bool> GenerateHeaderPerClass;
+	Override<bool> GenerateOffsetTable;
+	Override<bool> StreamPackages;
+	Override<bool> GenerateJson;
+	Override<bool> GenerateReflectionDatabase;
+	Override<size_t> UnityBuildUnitCount;
+	Override<size_t> PipelineQueueCapacity;
+	Override<size_t> ThreadCount;
+
+	/// <summary>
+	/// Constructor.
+	/// </summary>
+	/// <param name="_base">The generator to wrap. It must exist as long as this object.</param>
+	explicit GeneratorOverrides(IGenerator& _base)
+		: base(_base)
+	{
+	}
+
+	virtual bool Initialize(void* module) override
+	{
+		return base.Initialize(module);
+	}
+
+	virtual std::string GetOutputDirectory() const override
+	{
+		return OutputDirectory.Get(base.GetOutputDirectory());
+	}
+
+	virtual std::string GetGameName() const override
+	{
+		return base.GetGameName();
+	}
+
+	virtual std::string GetGameNameShort() const override
+	{
+		return base.GetGameNameShort();
+	}
+
+	virtual std::string GetGameVersion() const override
+	{
+		return base.GetGameVersion();
+	}
+
+	virtual bool ShouldDumpArrays() const override
+	{
+		return DumpArrays.Get(base.ShouldDumpArrays());
+	}
+
+	virtual bool ShouldCaptureSnapshot() const override
+	{
+		return CaptureSnapshot.Get(base.ShouldCaptureSnapshot());
+	}
+
+	virtual bool ShouldSaveSnapshotFile() const override
+	{
+		return SaveSnapshotFile.Get(base.ShouldSaveSnapshotFile());
+	}
+
+	virtual bool ShouldGenerateEmptyFiles() const override
+	{
+		return base.ShouldGenerateEmptyFiles();
+	}
+
+	virtual bool ShouldUseStrings() const override
+	{
+		return base.ShouldUseStrings();
+	}
+
+	virtual bool ShouldXorStrings() const override
+	{
+		return base.ShouldXorStrings();
+	}
+
+	virtual bool ShouldCallNativeFunctionsDirectly() const override
+	{
+		return base.ShouldCallNativeFunctionsDirectly();
+	}
+
+	virtual bool ShouldGenerateBatchMethods() const override
+	{
+		return base.ShouldGenerateBatchMethods();
+	}
+
+	virtual bool ShouldGenerateLiteSDK() const override
+	{
+		return GenerateLiteSDK.Get(base.ShouldGenerateLiteSDK());
+	}
+
+	virtual bool ShouldGenerateHeaderPerClass() const override
+	{
+		return GenerateHeaderPerClass.Get(base.ShouldGenerateHeaderPerClass());
+	}
+
+	virtual bool ShouldGenerateOffsetTable() const override
+	{
+		return GenerateOffsetTable.Get(base.ShouldGenerateOffsetTable());
+	}
+
+	virtual bool ShouldStreamPackages() const override
+	{
+		return StreamPackages.Get(base.ShouldStreamPackages());
+	}
+
+	virtual bool ShouldGenerateJson() const override
+	{
+		return GenerateJson.Get(base.ShouldGenerateJson());
+	}
+
+	virtual bool ShouldGenerateReflectionDatabase() const override
+	{
+		return GenerateReflectionDatabase.Get(base.ShouldGenerateReflectionDatabase());
+	}
+
+	virtual size_t GetUnityBuildUnitCount() const override
+	{
+		return UnityBuildUnitCount.Get(base.GetUnityBuildUnitCount());
+	}
+
+	virtual size_t GetPipelineQueueCapacity() const override
+	{
+		return PipelineQueueCapacity.Get(base.GetPipelineQueueCapacity());
+	}
+
+	virtual size_t GetThreadCount() const override
+	{
+		return ThreadCount.Get(base.GetThreadCount());
+	}
+
+	virtual std::string GetNamespaceName() const override
+	{
+		return base.GetNamespaceName();
+	}
+
+	virtual std::vector<std::string> GetIncludes() const override
+	{
+		return base.GetIncludes();
+	}
+
+	virtual size_t GetGlobalMemberAlignment() const override
+	{
+		return base.GetGlobalMemberAlignment();
+	}
+
+	virtual size_t GetClassAlignas(const std::string& name) const override
+	{
+		return base.GetClassAlignas(name);
+	}
+
+	virtual std::string GetBasicDeclarations() const override
+	{
+		return base.GetBasicDeclarations();
+	}
+
+	virtual std::string GetBasicDefinitions() const override
+	{
+		return base.GetBasicDefinitions();
+	}
+
+	virtual std::string GetOverrideType(const std::string& type) const override
+	{
+		return base.GetOverrideType(type);
+	}
+
+	virtual bool GetPredefinedClassMembers(const std::string& name, std::vector<PredefinedMember>& members) const override
+	{
+		return base.GetPredefinedClassMembers(name, members);
+	}
+
+	virtual bool GetPredefinedClassStaticMembers(const std::string& name, std::vector<PredefinedMember>& members) const override
+	{
+		return base.GetPredefinedClassStaticMembers(name, members);
+	}
+
+	virtual bool GetVirtualFunctionPatterns(const std::string& name, VirtualFunctionPatterns& patterns) const override
+	{
+		return base.GetVirtualFunctionPatterns(name, patterns);
+	}
+
+	virtual bool GetPredefinedClassMethods(const std::string& name, std::vector<PredefinedMethod>& methods) const override
+	{
+		return base.GetPredefinedClassMethods(name, methods);
+	}
+
+private:
+	IGenerator& base;
+};
@@ -55,6 +55,27 @@ public:
 		return true;
 	}
 
+	/// <summary>
+	/// Check if the generator should capture the object and name arrays before it starts.
+	/// Only the object pointers and the names are copied, the objects themselves are still read from the game.
+	/// Afterwards the object iteration skips the empty slots of the object array and the names are read without locking.
+	/// </summary>
+	/// <returns>true if the arrays should get captured.</returns>
+	virtual bool ShouldCaptureSnapshot() const
+	{
+		return false;
+	}
+
+	/// <summary>
+	/// Check if the generator should save the reflection data of the objects as snapshot file (XXX_Snapshot.bin).
+	/// The file can be used as source of the command line driver to generate the SDK again without the game.
+	/// </summary>
+	/// <returns>true if the snapshot file should get saved.</returns>
+	virtual bool ShouldSaveSnapshotFile() const
+	{
+		return false;
+	}
+
 	/// <summary>
 	/// Check if the generator should generate empty files (no classes, structs, ...).
 	/// </summary>
@@ -84,6 +105,115 @@ public:
 		return false;
 	}
 
+	/// <summary>
+	/// Check if native functions should call the native thunk (UFunction::Func) directly instead of using ProcessEvent.
+	/// Functions with out parameters always use ProcessEvent. The basic declarations must provide UObject::CallNativeFunction.
+	/// </summary>
+	/// <returns>true if native functions should be called directly.</returns>
+	virtual bool ShouldCallNativeFunctionsDirectly() const
+	{
+		return false;
+	}
+
+	/// <summary>
+	/// Check if the generator should generate a batch variant (Name_Batch) of every non static method without out parameters.
+	/// The batch variant calls the function on many objects with one parameter struct and writes the return values into an array.
+	/// </summary>
+	/// <returns>true if batch methods should get generated.</returns>
+	virtual bool ShouldGenerateBatchMethods() const
+	{
+		return false;
+	}
+
+	/// <summary>
+	/// Check if the generator should additionally generate the lite SDK (SDK_Lite.hpp).
+	/// The lite SDK only contains constexpr offsets, sizes and member accessors of the structs and classes.
+	/// </summary>
+	/// <returns>true if the lite SDK should get generated.</returns>
+	virtual bool ShouldGenerateLiteSDK() const
+	{
+		return false;
+	}
+
+	/// <summary>
+	/// Check if the generator should generate one header per struct and class.
+	/// Every header only includes the headers of its base and by-value members. Pointer members use the forward declarations.
+	/// </summary>
+	/// <returns>true if one header per struct and class should get generated.</returns>
+	virtual bool ShouldGenerateHeaderPerClass() const
+	{
+		return false;
+	}
+
+	/// <summary>
+	/// Check if the generator should additionally generate the runtime offset table (XXX_Offsets.bin) of the lite SDK.
+	/// Tools compiled with LITE_DYNAMIC_OFFSETS read the member offsets from the table, so they keep working with a table generated for a newer build of the game.
+	/// The ids of an existing table in the output directory are kept. Only used if <see cref="ShouldGenerateLiteSDK()" /> is true.
+	/// </summary>
+	/// <returns>true if the offset table should get generated.</returns>
+	virtual bool ShouldGenerateOffsetTable() const
+	{
+		return false;
+	}
+
+	/// <summary>
+	/// Check if the generator should write every struct and class as soon as it is generated instead of keeping the whole package in memory.
+	/// The enums and constants of a package get written to a separate file (XXX_Package_enums.hpp).
+	/// </summary>
+	/// <returns>true if the packages should get streamed.</returns>
+	virtual bool ShouldStreamPackages() const
+	{
+		return false;
+	}
+
+	/// <summary>
+	/// Check if the generator should additionally write the classes, structs and enums of every package as JSON (JSON/XXX_Package.json).
+	/// </summary>
+	/// <returns>true if the JSON files should get generated.</returns>
+	virtual bool ShouldGenerateJson() const
+	{
+		return false;
+	}
+
+	/// <summary>
+	/// Check if the generator should additionally generate the binary reflection database (XXX_Reflection.db).
+	/// The database contains the names, objects, structs, members, functions and enums as fixed-size records and can be read with ReflectionDatabaseReader.hpp.
+	/// </summary>
+	/// <returns>true if the reflection database should get generated.</returns>
+	virtual bool ShouldGenerateReflectionDatabase() const
+	{
+		return false;
+	}
+
+	/// <summary>
+	/// Gets the number of unity translation units (XXX_Unity_NN.cpp) which include the package function files.
+	/// The packages are distributed by size and every unit includes the XXX_PCH.hpp header first.
+	/// </summary>
+	/// <returns>The number of units or 0 if no unity build should get generated.</returns>
+	virtual size_t GetUnityBuildUnitCount() const
+	{
+		return 0;
+	}
+
+	/// <summary>
+	/// Gets the capacity of the queues between the reflect, format and write stages of the package generation.
+	/// At most this number of processed packages and formatted packages are kept in memory at the same time.
+	/// </summary>
+	/// <returns>The queue capacity.</returns>
+	virtual size_t GetPipelineQueueCapacity() const
+	{
+		return 2;
+	}
+
+	/// <summary>
+	/// Gets the number of worker threads which format the object and name dumps.
+	/// </summary>
+	/// <returns>The number of threads or 0 to use one thread per hardware thread.</returns>
+	virtual size_t GetThreadCount() const
+	{
+		return 0;
+	}
+
 	/// <summary>
 	/// Gets namespace name for the classes. If the name is empty no nammespace gets generated.
 	/// </summary>
@@ -0,0 +1,280 @@
+#include "JsonReader.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+const JsonValue* JsonValue::Find(const std::string& key) const
+{
+	for (auto&& member : members)
+	{
+		if (member.first == key)
+		{
+			return &member.second;
+		}
+	}
+	return nullptr;
+}
+
+JsonReader::JsonReader(const std::string& text)
+	: it(text.c_str()),
+	  end(text.c_str() + text.length())
+{
+}
+
+bool JsonReader::Parse(const std::string& text, JsonValue& value)
+{
+	JsonReader reader(text);
+
+	if (!reader.ParseValue(value, 0))
+	{
+		return false;
+	}
+
+	reader.SkipWhitespace();
+
+	return reader.it == reader.end;
+}
+
+void JsonReader::SkipWhitespace()
+{
+	while (it != end && (*it == ' ' || *it == '\t' || *it == '\n' || *it == '\r'))
+	{
+		++it;
+	}
+}
+
+bool JsonReader::ParseValue(JsonValue& value, size_t depth)
+{
+	//limit the nesting so a broken file can not overflow the stack
+	if (depth > 128)
+	{
+		return false;
+	}
+
+	SkipWhitespace();
+	if (it == end)
+	{
+		return false;
+	}
+
+	switch (*it)
+	{
+		case '{':
+		{
+			value.type = JsonValue::Type::Object;
+
+			++it;
+			SkipWhitespace();
+			if (it != end && *it == '}')
+			{
+				++it;
+				return true;
+			}
+
+			while (true)
+			{
+				SkipWhitespace();
+
+				std::pair<std::string, JsonValue> member;
+				if (!ParseString(member.first))
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+				if (it == end || *it != ':')
+				{
+					return false;
+				}
+				++it;
+
+				if (!ParseValue(member.second, depth + 1))
+				{
+					return false;
+				}
+				value.members.push_back(std::move(member));
+
+				SkipWhitespace();
+				if (it == end)
+				{
+					return false;
+				}
+				if (*it == '}')
+				{
+					++it;
+					return true;
+				}
+				if (*it != ',')
+				{
+					return false;
+				}
+				++it;
+			}
+		}
+		case '[':
+		{
+			value.type = JsonValue::Type::Array;
+
+			++it;
+			SkipWhitespace();
+			if (it != end && *it == ']')
+			{
+				++it;
+				return true;
+			}
+
+			while (true)
+			{
+				JsonValue element;
+				if (!ParseValue(element, depth + 1))
+				{
+					return false;
+				}
+				value.elements.push_back(std::move(element));
+
+				SkipWhitespace();
+				if (it == end)
+				{
+					return false;
+				}
+				if (*it == ']')
+				{
+					++it;
+					return true;
+				}
+				if (*it != ',')
+				{
+					return false;
+				}
+				++it;
+			}
+		}
+		case '"':
+			value.type = JsonValue::Type::String;
+			return ParseString(value.str);
+		case 't':
+			value.type = JsonValue::Type::Bool;
+			value.boolean = true;
+			return ParseLiteral("true");
+		case 'f':
+			value.type = JsonValue::Type::Bool;
+			value.boolean = false;
+			return ParseLiteral("false");
+		case 'n':
+			value.type = JsonValue::Type::Null;
+			return ParseLiteral("null");
+		default:
+			value.type = JsonValue::Type::Number;
+			return ParseNumber(value.number);
+	}
+}
+
+bool JsonReader::ParseString(std::string& str)
+{
+	if (it == end || *it != '"')
+	{
+		return false;
+	}
+	++it;
+
+	while (it != end)
+	{
+		auto c = *it++;
+		if (c == '"')
+		{
+			return true;
+		}
+		if (c != '\\')
+		{
+			str += c;
+			continue;
+		}
+
+		if (it == end)
+		{
+			return false;
+		}
+		switch (*it++)
+		{
+			case '"': str += '"'; break;
+			case '\\': str += '\\'; break;
+			case '/': str += '/'; break;
+			case 'b': str += '\b'; break;
+			case 'f': str += '\f'; break;
+			case 'n': str += '\n'; break;
+			case 'r': str += '\r'; break;
+			case 't': str += '\t'; break;
+			case 'u':
+			{
+				if (end - it < 4)
+				{
+					return false;
+				}
+
+				unsigned long code = 0;
+				for (auto i = 0; i < 4; ++i)
+				{
+					auto h = *it++;
+					code <<= 4;
+					if (h >= '0' && h <= '9') code |= h - '0';
+					else if (h >= 'a' && h <= 'f') code |= h - 'a' + 10;
+					else if (h >= 'A' && h <= 'F') code |= h - 'A' + 10;
+					else return false;
+				}
+
+				//surrogate pairs are not combined, every code unit is encoded on its own
+				if (code < 0x80)
+				{
+					str += static_cast<char>(code);
+				}
+				else if (code < 0x800)
+				{
+					str += static_cast<char>(0xC0 | (code >> 6));
+					str += static_cast<char>(0x80 | (code & 0x3F));
+				}
+				else
+				{
+					str += static_cast<char>(0xE0 | (code >> 12));
+					str += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+					str += static_cast<char>(0x80 | (code & 0x3F));
+				}
+				break;
+			}
+			default:
+				return false;
+		}
+	}
+
+	return false;
+}
+
+bool JsonReader::ParseNumber(double& number)
+{
+	auto start = it;
+	while (it != end && (std::strchr("+-0123456789.eE", *it) != nullptr))
+	{
+		++it;
+	}
+	if (it == start)
+	{
+		return false;
+	}
+
+	std::string text(start, it);
+
+	char* parsedEnd;
+	number = std::strtod(text.c_str(), &parsedEnd);
+
+	return parsedEnd == text.c_str() + text.length();
+}
+
+bool JsonReader::ParseLiteral(const char* literal)
+{
+	auto length = std::strlen(literal);
+	if (static_cast<size_t>(end - it) < length || std::strncmp(it, literal, length) != 0)
+	{
+		return false;
+	}
+	it += length;
+	return true;
+}
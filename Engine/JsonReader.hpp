@@ -0,0 +1,107 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+
+/// <summary>
+/// A parsed JSON value. Objects keep the order of their members.
+/// </summary>
+class JsonValue
+{
+	friend class JsonReader;
+
+public:
+	enum class Type
+	{
+		Null,
+		Bool,
+		Number,
+		String,
+		Array,
+		Object
+	};
+
+	JsonValue()
+		: type(Type::Null),
+		  boolean(false),
+		  number(0.0)
+	{
+	}
+
+	Type GetType() const
+	{
+		return type;
+	}
+
+	bool GetBool() const
+	{
+		return boolean;
+	}
+
+	double GetNumber() const
+	{
+		return number;
+	}
+
+	const std::string& GetString() const
+	{
+		return str;
+	}
+
+	const std::vector<JsonValue>& GetArray() const
+	{
+		return elements;
+	}
+
+	const std::vector<std::pair<std::string, JsonValue>>& GetMembers() const
+	{
+		return members;
+	}
+
+	/// <summary>
+	/// Searches a member of an object.
+	/// </summary>
+	/// <param name="key">The key of the member.</param>
+	/// <returns>The value or nullptr if the value is no object or has no such member.</returns>
+	const JsonValue* Find(const std::string& key) const;
+
+private:
+	Type type;
+	bool boolean;
+	double number;
+	std::string str;
+	std::vector<JsonValue> elements;
+	std::vector<std::pair<std::string, JsonValue>> members;
+};
+
+/// <summary>
+/// Parses JSON documents, for example the files which are written with <see cref="JsonWriter" />.
+/// </summary>
+class JsonReader
+{
+public:
+	/// <summary>
+	/// Parses a JSON document.
+	/// </summary>
+	/// <param name="text">The document.</param>
+	/// <param name="value">[out] The root value.</param>
+	/// <returns>true if the document is valid, false if not.</returns>
+	static bool Parse(const std::string& text, JsonValue& value);
+
+private:
+	explicit JsonReader(const std::string& text);
+
+	bool ParseValue(JsonValue& value, size_t depth);
+
+	bool ParseString(std::string& str);
+
+	bool ParseNumber(double& number);
+
+	bool ParseLiteral(const char* literal);
+
+	void SkipWhitespace();
+
+	const char* it;
+	const char* end;
+};
@@ -0,0 +1,160 @@
+#include "JsonWriter.hpp"
+
+JsonWriter::JsonWriter(std::ostream& _os)
+	: os(_os),
+	  afterKey(false)
+{
+}
+
+void JsonWriter::BeginValue()
+{
+	if (afterKey)
+	{
+		afterKey = false;
+		return;
+	}
+
+	if (!empty.empty())
+	{
+		if (!empty.back())
+		{
+			os.put(',');
+		}
+		empty.back() = false;
+
+		os.put('\n');
+		for (auto i = 0u; i < empty.size(); ++i)
+		{
+			os.put('\t');
+		}
+	}
+}
+
+void JsonWriter::End(char c)
+{
+	auto wasEmpty = empty.back();
+	empty.pop_back();
+
+	if (!wasEmpty)
+	{
+		os.put('\n');
+		for (auto i = 0u; i < empty.size(); ++i)
+		{
+			os.put('\t');
+		}
+	}
+	os.put(c);
+
+	if (empty.empty())
+	{
+		os.put('\n');
+	}
+}
+
+void JsonWriter::BeginObject()
+{
+	BeginValue();
+	os.put('{');
+	empty.push_back(true);
+}
+
+void JsonWriter::EndObject()
+{
+	End('}');
+}
+
+void JsonWriter::BeginArray()
+{
+	BeginValue();
+	os.put('[');
+	empty.push_back(true);
+}
+
+void JsonWriter::EndArray()
+{
+	End(']');
+}
+
+void JsonWriter::Key(const char* key)
+{
+	BeginValue();
+	os.put('"');
+	os << key;
+	os.write("\": ", 3);
+	afterKey = true;
+}
+
+void JsonWriter::String(const char* str, size_t length)
+{
+	BeginValue();
+	WriteEscaped(os, str, length);
+}
+
+void JsonWriter::Number(uint64_t value)
+{
+	BeginValue();
+	os << value;
+}
+
+void JsonWriter::Bool(bool value)
+{
+	BeginValue();
+	if (value)
+	{
+		os.write("true", 4);
+	}
+	else
+	{
+		os.write("false", 5);
+	}
+}
+
+void JsonWriter::WriteEscaped(std::ostream& os, const char* str, size_t length)
+{
+	static const char hex[] = "0123456789abcdef";
+
+	os.put('"');
+
+	auto end = str + length;
+	while (str != end)
+	{
+		//find the run of characters which can be written as they are
+		auto run = str;
+		while (run != end)
+		{
+			auto c = static_cast<unsigned char>(*run);
+			if (c < 0x20 || c == '"' || c == '\\')
+			{
+				break;
+			}
+			++run;
+		}
+		if (run != str)
+		{
+			os.write(str, run - str);
+			str = run;
+			if (str == end)
+			{
+				break;
+			}
+		}
+
+		auto c = static_cast<unsigned char>(*str++);
+		switch (c)
+		{
+			case '"': os.write("\\\"", 2); break;
+			case '\\': os.write("\\\\", 2); break;
+			case '\n': os.write("\\n", 2); break;
+			case '\r': os.write("\\r", 2); break;
+			case '\t': os.write("\\t", 2); break;
+			default:
+			{
+				char escaped[] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF] };
+				os.write(escaped, sizeof(escaped));
+				break;
+			}
+		}
+	}
+
+	os.put('"');
+}
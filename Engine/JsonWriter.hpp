@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <cstdint>
+
+/// <summary>
+/// Writes JSON directly to a stream without building a document in memory.
+/// The writer only keeps the nesting state and inserts the separators and the indentation.
+/// </summary>
+class JsonWriter
+{
+public:
+	/// <summary>
+	/// Constructor.
+	/// </summary>
+	/// <param name="os">The stream to write to.</param>
+	explicit JsonWriter(std::ostream& os);
+
+	void BeginObject();
+
+	void EndObject();
+
+	void BeginArray();
+
+	void EndArray();
+
+	/// <summary>
+	/// Writes the key of the next value in an object.
+	/// </summary>
+	/// <param name="key">The key. It is not escaped.</param>
+	void Key(const char* key);
+
+	void String(const char* str, size_t length);
+
+	void String(const std::string& str)
+	{
+		String(str.c_str(), str.length());
+	}
+
+	void Number(uint64_t value);
+
+	void Bool(bool value);
+
+	/// <summary>
+	/// Writes an escaped JSON string with quotes. Runs of characters which need no escaping are written at once.
+	/// UTF-8 characters are written as they are.
+	/// </summary>
+	/// <param name="os">The stream to write to.</param>
+	/// <param name="str">The string.</param>
+	/// <param name="length">The length of the string.</param>
+	static void WriteEscaped(std::ostream& os, const char* str, size_t length);
+
+private:
+	/// <summary>
+	/// Writes the separator and the indentation before a value.
+	/// </summary>
+	void BeginValue();
+
+	void End(char c);
+
+	std::ostream& os;
+
+	/// <summary>
+	/// For every open object or array: true if it has no values yet.
+	/// </summary>
+	std::vector<bool> empty;
+
+	bool afterKey;
+};
@@ -1,16 +1,156 @@
 #include "Logger.hpp"
 
+#include <mutex>
+#include <thread>
+#include <atomic>
+
+#include "RingBuffer.hpp"
+
 std::ostream* Logger::stream = nullptr;
 
+namespace
+{
+	RingBuffer<std::string> messages(4096);
+
+	std::atomic<bool> running(false);
+	std::thread writerThread;
+
+	//number of Log calls which may still push a message, SetStream waits for them before it switches the stream
+	std::atomic<int> activeWriters(0);
+	//number of messages which got pushed (or are being pushed), popped and popped + flushed
+	//a message is behind all messages whose push started before its own push finished
+	std::atomic<uint64_t> pushedCount(0);
+	uint64_t poppedCount = 0;
+	std::atomic<uint64_t> flushedCount(0);
+	//number of Log calls which wait for a flush, the writer thread flushes after every batch while there are some
+	std::atomic<int> flushWaiters(0);
+
+	//guards SetStream only, logging never takes the lock
+	std::mutex streamMutex;
+}
+
 void Logger::SetStream(std::ostream* _stream)
 {
+	std::lock_guard<std::mutex> lock(streamMutex);
+
+	if (writerThread.joinable())
+	{
+		running = false;
+		while (activeWriters != 0)
+		{
+			std::this_thread::yield();
+		}
+		writerThread.join();
+
+		//messages pushed after the last check of the writer thread still belong to the old stream
+		std::string message;
+		while (messages.TryPop(message))
+		{
+			*stream << message << '\n';
+			++poppedCount;
+		}
+		stream->flush();
+		flushedCount = poppedCount;
+	}
+
 	stream = _stream;
+
+	if (stream != nullptr)
+	{
+		running = true;
+		writerThread = std::thread(WriteMessages);
+	}
 }
 
-void Logger::Log(const std::string& message)
+void Logger::Log(LogLevel level, std::string message)
 {
-	if (stream != nullptr)
+	struct ActiveWriter
+	{
+		ActiveWriter() { ++activeWriters; }
+		~ActiveWriter() { --activeWriters; }
+	} activeWriter;
+
+	if (!running)
+	{
+		return;
+	}
+
+	switch (level)
+	{
+		case LogLevel::Warning:
+			message.insert(0, "Warning: ");
+			break;
+		case LogLevel::Error:
+			message.insert(0, "Error: ");
+			break;
+		default:
+			break;
+	}
+
+	//the writer thread drains the buffer, so a full buffer only waits until it made room
+	++pushedCount;
+	while (!messages.TryPush(message))
 	{
-		(*stream) << message << '\n' << std::flush;
+		if (!running)
+		{
+			--pushedCount;
+			return;
+		}
+		std::this_thread::yield();
+	}
+
+	//warnings and errors must be in the file if the process crashes afterwards, so wait until they got flushed
+	if (level >= LogLevel::Warning)
+	{
+		auto target = pushedCount.load();
+
+		++flushWaiters;
+		while (flushedCount < target && running)
+		{
+			std::this_thread::yield();
+		}
+		--flushWaiters;
+	}
+}
+
+void Logger::WriteMessages()
+{
+	std::string batch;
+	std::string message;
+
+	while (true)
+	{
+		//read the flag first, so all messages logged before the stop get written
+		auto stop = !running;
+
+		while (batch.size() < 64 * 1024 && messages.TryPop(message))
+		{
+			batch += message;
+			batch += '\n';
+			++poppedCount;
+		}
+
+		if (!batch.empty())
+		{
+			stream->write(batch.data(), batch.size());
+			batch.clear();
+
+			if (flushWaiters != 0)
+			{
+				stream->flush();
+				flushedCount = poppedCount;
+			}
+			continue;
+		}
+
+		stream->flush();
+		flushedCount = poppedCount;
+
+		if (stop)
+		{
+			return;
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
 	}
 }
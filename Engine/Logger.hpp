@@ -6,24 +6,52 @@
 
 #include "tinyformat.h"
 
+enum class LogLevel
+{
+	Debug,
+	Info,
+	Warning,
+	Error
+};
+
+/// <summary>
+/// The minimum level of the messages which get logged. Calls below this level are removed at compile time and don't format their arguments.
+/// 0 = Debug, 1 = Info, 2 = Warning, 3 = Error
+/// </summary>
+#ifndef LOGGER_MIN_LEVEL
+#define LOGGER_MIN_LEVEL 0
+#endif
+
 class Logger
 {
 public:
 
 	/// <summary>
 	/// Sets the stream where the output goes to.
+	/// The messages are written by a background thread. Setting a new stream (or nullptr) waits for running Log calls and writes all pending messages to the old stream first.
 	/// </summary>
 	/// <param name="stream">[in] The stream.</param>
 	static void SetStream(std::ostream* stream);
 
 	/// <summary>
-	/// Logs the given message.
+	/// Logs the given message. The message is added to a lock-free queue, so this method can be called from any thread.
+	/// Warnings and errors return after the message got flushed to the stream.
+	/// </summary>
+	/// <param name="level">The level of the message.</param>
+	/// <param name="message">The message.</param>
+	static void Log(LogLevel level, std::string message);
+
+	/// <summary>
+	/// Logs the given message with the Info level.
 	/// </summary>
 	/// <param name="message">The message.</param>
-	static void Log(const std::string& message);
+	static void Log(const std::string& message)
+	{
+		Write<LogLevel::Info>(message);
+	}
 
 	/// <summary>
-	/// Formats and logs the given message.
+	/// Formats and logs the given message with the Info level.
 	/// </summary>
 	/// <typeparam name="Args">Type of the arguments.</typeparam>
 	/// <param name="fmt">Describes the format to use.</param>
@@ -31,9 +59,50 @@ public:
 	template<typename... Args>
 	static void Log(const char* fmt, const Args&... args)
 	{
-		Log(tfm::format(fmt, args...));
+		Write<LogLevel::Info>(fmt, args...);
+	}
+
+	template<typename... Args>
+	static void Debug(const char* fmt, const Args&... args)
+	{
+		Write<LogLevel::Debug>(fmt, args...);
+	}
+
+	template<typename... Args>
+	static void Warning(const char* fmt, const Args&... args)
+	{
+		Write<LogLevel::Warning>(fmt, args...);
+	}
+
+	template<typename... Args>
+	static void Error(const char* fmt, const Args&... args)
+	{
+		Write<LogLevel::Error>(fmt, args...);
 	}
 
 private:
+	template<LogLevel Level>
+	static void Write(const std::string& message)
+	{
+		if (static_cast<int>(Level) >= LOGGER_MIN_LEVEL)
+		{
+			Log(Level, message);
+		}
+	}
+
+	template<LogLevel Level, typename... Args>
+	static void Write(const char* fmt, const Args&... args)
+	{
+		if (static_cast<int>(Level) >= LOGGER_MIN_LEVEL)
+		{
+			Log(Level, tfm::format(fmt, args...));
+		}
+	}
+
+	/// <summary>
+	/// Writes the queued messages to the stream until the stream gets changed.
+	/// </summary>
+	static void WriteMessages();
+
 	static std::ostream *stream;
 };
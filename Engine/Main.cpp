@@ -5,11 +5,18 @@
 #include <windows.h>
 
 #include <fstream>
+#include <sstream>
 #include <unordered_set>
 #include <unordered_map>
 #include <chrono>
 #include <filesystem>
 #include <bitset>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 namespace fs = std::experimental::filesystem;
 #include "cpplinq.hpp"
 
@@ -18,35 +25,224 @@ namespace fs = std::experimental::filesystem;
 #include "IGenerator.hpp"
 #include "ObjectsStore.hpp"
 #include "NamesStore.hpp"
+#include "SyntheticUniverse.hpp"
 #include "Package.hpp"
 #include "NameValidator.hpp"
 #include "PrintHelper.hpp"
+#include "BoundedQueue.hpp"
+#include "ReflectionDatabaseWriter.hpp"
+#include "ReflectionDatabaseReader.hpp"
+#include "OffsetTableWriter.hpp"
+#include "Profiler.hpp"
+#include "Driver.hpp"
 
 extern IGenerator* generator;
 
+/// <summary>
+/// Writes the lines of a table to a file. Chunks of lines are formatted in parallel and written in index order.
+/// </summary>
+/// <param name="file">The file to create.</param>
+/// <param name="count">The number of entries in the table.</param>
+/// <param name="printLine">The function which prints the entry with the given index to the stream.</param>
+template<typename PrintLine>
+void DumpTable(const fs::path& file, size_t count, PrintLine printLine)
+{
+	Profiler::Scope scope("DumpTable", file.filename().string());
+
+	const size_t linesPerChunk = 4096;
+
+	auto chunkCount = (count + linesPerChunk - 1) / linesPerChunk;
+	size_t threadCount = generator->GetThreadCount();
+	if (threadCount == 0)
+	{
+		threadCount = std::thread::hardware_concurrency();
+	}
+	if (threadCount > chunkCount)
+	{
+		threadCount = chunkCount;
+	}
+	if (threadCount == 0)
+	{
+		threadCount = 1;
+	}
+	//the formatters may run ahead of the writer by this number of chunks
+	const auto maxPending = threadCount * 2;
+
+	std::vector<std::string> chunks(chunkCount);
+	std::vector<bool> formatted(chunkCount, false);
+	size_t nextChunk = 0;
+	size_t writtenChunks = 0;
+
+	std::mutex mutex;
+	std::condition_variable chunkFormatted;
+	std::condition_variable chunkWritten;
+
+	std::vector<std::thread> threads;
+	for (auto i = 0u; i < threadCount; ++i)
+	{
+		threads.emplace_back([&]()
+		{
+			while (true)
+			{
+				size_t chunk;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+
+					chunkWritten.wait(lock, [&]() { return nextChunk >= chunkCount || nextChunk < writtenChunks + maxPending; });
+					if (nextChunk >= chunkCount)
+					{
+						return;
+					}
+					chunk = nextChunk++;
+				}
+
+				std::ostringstream os;
+
+				auto end = (std::min)(count, (chunk + 1) * linesPerChunk);
+				for (auto index = chunk * linesPerChunk; index < end; ++index)
+				{
+					printLine(os, index);
+				}
+
+				std::lock_guard<std::mutex> lock(mutex);
+
+				chunks[chunk] = os.str();
+				formatted[chunk] = true;
+
+				chunkFormatted.notify_all();
+			}
+		});
+	}
+
+	{
+		std::ofstream o(file);
+
+		for (auto chunk = 0u; chunk < chunkCount; ++chunk)
+		{
+			std::string content;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+
+				chunkFormatted.wait(lock, [&]() { return formatted[chunk]; });
+
+				content = std::move(chunks[chunk]);
+			}
+
+			o.write(content.data(), content.length());
+
+			Profiler::Increment(Profiler::Counter::BytesWritten, content.length());
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				++writtenChunks;
+
+				chunkWritten.notify_all();
+			}
+		}
+	}
+
+	for (auto&& thread : threads)
+	{
+		thread.join();
+	}
+}
+
 /// <summary>
 /// Dumps the objects and names to files.
 /// </summary>
 /// <param name="path">The path where to create the dumps.</param>
 void Dump(const fs::path& path)
 {
+	//like the store iterators the first entry is always printed, all other entries only if they are valid
+	{
+		ObjectsStore store;
+
+		DumpTable(path / "ObjectsDump.txt", store.GetObjectsNum(), [&store](std::ostream& os, size_t index)
+		{
+			auto obj = store.GetById(index);
+			if (index == 0 || obj.IsValid())
+			{
+				tfm::format(os, "[%06i] %-100s 0x%P\n", index, obj.GetFullName(), obj.GetAddress());
+			}
+		});
+	}
+
 	{
-		std::ofstream o(path / "ObjectsDump.txt");
+		NamesStore store;
 
-		for (auto obj : ObjectsStore())
+		DumpTable(path / "NamesDump.txt", store.GetNamesNum(), [&store](std::ostream& os, size_t index)
 		{
-			tfm::format(o, "[%06i] %-100s 0x%P\n", obj.Index, obj.Object.GetFullName(), obj.Object.GetAddress());
+			if (index == 0 || store.IsValid(index))
+			{
+				tfm::format(os, "[%06i] %s\n", index, store.GetCachedById(index));
+			}
+		});
+	}
+}
+
+/// <summary>
+/// Generates the forward declaration header which gets included by the single struct and class headers (see <see cref="IGenerator::ShouldGenerateHeaderPerClass()" />).
+/// </summary>
+/// <param name="path">The path where the sdk header gets created.</param>
+/// <param name="definedClasses">The defined classes info.</param>
+/// <param name="packageOrder">The package order info.</param>
+void SaveForwardHeader(const fs::path& path, const std::unordered_map<UEObject, bool>& definedClasses, const std::vector<UEObject>& packageOrder)
+{
+	using namespace cpplinq;
+
+	std::vector<std::string> includes = { "<set>", "<vector>", "<string>" };
+	for (auto&& i : generator->GetIncludes())
+	{
+		includes.push_back(i);
+	}
+	includes.push_back(tfm::format("\"%s_Basic.hpp\"", generator->GetGameNameShort()));
+	for (auto&& package : packageOrder)
+	{
+		includes.push_back(tfm::format("\"%s_%s_enums.hpp\"", generator->GetGameNameShort(), package.GetName()));
+	}
+
+	auto missing = from(definedClasses) >> where([](auto&& kv) { return kv.second == false; });
+	if (missing >> any())
+	{
+		includes.push_back(tfm::format("\"%s_MISSING.hpp\"", generator->GetGameNameShort()));
+
+		//the missing structs have no header, so add one which points to the MISSING file
+		for (auto&& s : missing >> select([](auto&& kv) { return kv.first.Cast<UEStruct>(); }) >> experimental::container())
+		{
+			std::ofstream os(path / "SDK" / Package::GetHeaderFileName(s));
+
+			PrintFileHeader(os, { tfm::format("\"%s_fwd.hpp\"", generator->GetGameNameShort()) });
+
+			PrintFileFooter(os);
 		}
 	}
 
+	std::ofstream os(path / "SDK" / tfm::format("%s_fwd.hpp", generator->GetGameNameShort()));
+
+	PrintFileHeader(os, includes);
+
+	PrintSectionHeader(os, "Forward Declarations");
+
+	for (auto&& kv : definedClasses)
 	{
-		std::ofstream o(path / "NamesDump.txt");
+		if (kv.second == false)
+		{
+			continue;
+		}
 
-		for (auto name : NamesStore())
+		if (kv.first.IsA<UEClass>())
 		{
-			tfm::format(o, "[%06i] %s\n", name.Index, name.Name);
+			os << "class " << MakeValidName(kv.first.GetNameCPP()) << ";\n";
+		}
+		else
+		{
+			os << "struct " << MakeUniqueCppName(kv.first.Cast<UEStruct>()) << ";\n";
 		}
 	}
+	os << "\n";
+
+	PrintFileFooter(os);
 }
 
 /// <summary>
@@ -64,6 +260,8 @@ void SaveSDKHeader(const fs::path& path, const std::unordered_map<UEObject, bool
 
 	//Includes
 	os << "#include <set>\n";
+	os << "#include <cstddef>\n";
+	os << "#include <vector>\n";
 	os << "#include <string>\n";
 	for (auto&& i : generator->GetIncludes())
 	{
@@ -118,6 +316,13 @@ void SaveSDKHeader(const fs::path& path, const std::unordered_map<UEObject, bool
 		os << "\n#include \"SDK/" << tfm::format("%s_MISSING.hpp", generator->GetGameNameShort()) << "\"\n";
 	}
 
+	if (generator->ShouldGenerateHeaderPerClass())
+	{
+		SaveForwardHeader(path, definedClasses, packageOrder);
+
+		os << "\n#include \"SDK/" << tfm::format("%s_fwd.hpp", generator->GetGameNameShort()) << "\"\n";
+	}
+
 	os << "\n";
 
 	for (auto&& package : packageOrder)
@@ -127,14 +332,324 @@ void SaveSDKHeader(const fs::path& path, const std::unordered_map<UEObject, bool
 	}
 }
 
+/// <summary>
+/// Generates the lite sdk header which only contains offsets and sizes.
+/// </summary>
+/// <param name="path">The path where to create the lite sdk header.</param>
+/// <param name="packageOrder">The package order info.</param>
+/// <param name="offsetTable">The runtime offset table or nullptr if no table is generated.</param>
+void SaveLiteSDKHeader(const fs::path& path, const std::vector<UEObject>& packageOrder, const OffsetTableWriter* offsetTable)
+{
+	std::ofstream os(path / "SDK_Lite.hpp");
+
+	os << "#pragma once\n\n"
+		<< tfm::format("// %s (%s) SDK (offsets only)\n\n", generator->GetGameName(), generator->GetGameVersion());
+
+	os << "#include <cstddef>\n";
+	os << "#include <cstdint>\n";
+	if (offsetTable)
+	{
+		os << "#include <cassert>\n";
+		os << "#include <cstring>\n";
+	}
+
+	{
+		std::ofstream os2(path / "SDK" / tfm::format("%s_Lite_Basic.hpp", generator->GetGameNameShort()));
+
+		std::vector<std::string> includes = { "<cstddef>", "<cstdint>" };
+		if (offsetTable)
+		{
+			includes.emplace_back("<cassert>");
+			includes.emplace_back("<cstring>");
+		}
+		PrintFileHeader(os2, includes);
+
+		os2 << R"(namespace Lite
+{
+
+template<typename T, size_t Offset>
+struct TMember
+{
+	static inline T& Get(void* object)
+	{
+		return *reinterpret_cast<T*>(static_cast<uint8_t*>(object) + Offset);
+	}
+
+	static inline const T& Get(const void* object)
+	{
+		return *reinterpret_cast<const T*>(static_cast<const uint8_t*>(object) + Offset);
+	}
+};
+
+}
+
+)";
+
+		if (offsetTable)
+		{
+			//the table pointer is a static member of a template, so the header can be included in multiple translation units
+			os2 << R"(namespace Lite
+{
+
+template<typename Dummy = void>
+struct TOffsetTable
+{
+	static const uint32_t InvalidOffset = 0xFFFFFFFF;
+
+	//newer tables keep the ids of this SDK and only append entries
+	static const uint32_t MinimumEntryCount = )" << offsetTable->GetEntryCount() << R"(;
+
+	static const uint32_t* Offsets;
+
+	//the data must stay valid as long as the table is used
+	static bool Load(const void* data, size_t size)
+	{
+		struct Header
+		{
+			char Magic[8];
+			uint32_t Version;
+			uint32_t EntryCount;
+			uint32_t NamesOffset;
+			uint32_t StringsOffset;
+			uint32_t StringsSize;
+			uint32_t Reserved;
+		};
+
+		auto header = static_cast<const Header*>(data);
+		if (size < sizeof(Header)
+			|| std::memcmp(header->Magic, "UESDKOT", sizeof(header->Magic)) != 0
+			|| header->Version != )" << OffsetTable::Version << R"(
+			|| header->EntryCount < MinimumEntryCount
+			|| size < sizeof(Header) + static_cast<uint64_t>(header->EntryCount) * sizeof(uint32_t))
+		{
+			return false;
+		}
+
+		Offsets = reinterpret_cast<const uint32_t*>(header + 1);
+		return true;
+	}
+
+	static inline bool IsLoaded()
+	{
+		return Offsets != nullptr;
+	}
+
+	//requires a successful Load()
+	static inline size_t Get(uint32_t id)
+	{
+		assert(IsLoaded());
+		return Offsets[id];
+	}
+
+	static inline bool IsValid(uint32_t id)
+	{
+		return IsLoaded() && Offsets[id] != InvalidOffset;
+	}
+};
+
+template<typename Dummy>
+const uint32_t* TOffsetTable<Dummy>::Offsets = nullptr;
+
+using OffsetTable = TOffsetTable<>;
+
+//Get() requires a successful OffsetTable::Load() and a member which exists in the loaded table,
+//TryGet() checks both and returns nullptr otherwise
+template<typename T, uint32_t Id>
+struct TDynamicMember
+{
+	static inline T& Get(void* object)
+	{
+		assert(OffsetTable::IsValid(Id));
+		return *reinterpret_cast<T*>(static_cast<uint8_t*>(object) + OffsetTable::Offsets[Id]);
+	}
+
+	static inline const T& Get(const void* object)
+	{
+		assert(OffsetTable::IsValid(Id));
+		return *reinterpret_cast<const T*>(static_cast<const uint8_t*>(object) + OffsetTable::Offsets[Id]);
+	}
+
+	static inline T* TryGet(void* object)
+	{
+		return OffsetTable::IsValid(Id) ? reinterpret_cast<T*>(static_cast<uint8_t*>(object) + OffsetTable::Offsets[Id]) : nullptr;
+	}
+
+	static inline const T* TryGet(const void* object)
+	{
+		return OffsetTable::IsValid(Id) ? reinterpret_cast<const T*>(static_cast<const uint8_t*>(object) + OffsetTable::Offsets[Id]) : nullptr;
+	}
+};
+
+#ifdef LITE_DYNAMIC_OFFSETS
+template<typename T, size_t Offset, uint32_t Id>
+using TPatchableMember = TDynamicMember<T, Id>;
+#else
+template<typename T, size_t Offset, uint32_t Id>
+using TPatchableMember = TMember<T, Offset>;
+#endif
+
+}
+
+)";
+		}
+
+		PrintFileFooter(os2);
+
+		os << "\n#include \"SDK/" << tfm::format("%s_Lite_Basic.hpp", generator->GetGameNameShort()) << "\"\n";
+	}
+
+	os << "\n";
+
+	for (auto&& package : packageOrder)
+	{
+		os << R"(#include "SDK/)" << tfm::format("%s_%s_offsets.hpp", generator->GetGameNameShort(), package.GetName()) << "\"\n";
+	}
+}
+
+/// <summary>
+/// Groups the package function files into unity translation units (see <see cref="IGenerator::GetUnityBuildUnitCount()" />).
+/// The packages are distributed by their line count, so every unit has roughly the same size.
+/// </summary>
+/// <param name="path">The path where the sdk header gets created.</param>
+/// <param name="packageOrder">The package order info.</param>
+void SaveUnityBuild(const fs::path& path, const std::vector<UEObject>& packageOrder)
+{
+	struct Unit
+	{
+		std::vector<std::string> Files;
+		size_t Lines;
+	};
+
+	auto unitCount = generator->GetUnityBuildUnitCount();
+	if (unitCount > packageOrder.size())
+	{
+		unitCount = packageOrder.size();
+	}
+	if (unitCount == 0)
+	{
+		return;
+	}
+
+	std::vector<std::pair<std::string, size_t>> files;
+	for (auto&& package : packageOrder)
+	{
+		auto fileName = tfm::format("%s_%s_functions.cpp", generator->GetGameNameShort(), package.GetName());
+
+		std::ifstream is(path / "SDK" / fileName);
+		auto lines = std::count(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>(), '\n');
+
+		files.emplace_back(fileName, static_cast<size_t>(lines));
+	}
+
+	//the biggest files first, every file goes into the smallest unit
+	std::stable_sort(std::begin(files), std::end(files), [](auto&& lhs, auto&& rhs) { return lhs.second > rhs.second; });
+
+	std::vector<Unit> units(unitCount, Unit{ {}, 0 });
+	for (auto&& file : files)
+	{
+		auto unit = std::min_element(std::begin(units), std::end(units), [](auto&& lhs, auto&& rhs) { return lhs.Lines < rhs.Lines; });
+		unit->Files.push_back(file.first);
+		unit->Lines += file.second;
+	}
+
+	auto pchName = tfm::format("%s_PCH.hpp", generator->GetGameNameShort());
+	{
+		std::ofstream os(path / "SDK" / pchName);
+
+		os << "#pragma once\n\n"
+			<< tfm::format("// %s (%s) SDK\n\n", generator->GetGameName(), generator->GetGameVersion())
+			<< "#include \"../SDK.hpp\"\n";
+	}
+
+	std::ofstream list(path / "SDK_Unity.txt");
+	list << "SDK/" << tfm::format("%s_Basic.cpp", generator->GetGameNameShort()) << "\n";
+
+	for (auto i = 0u; i < units.size(); ++i)
+	{
+		auto unitName = tfm::format("%s_Unity_%02d.cpp", generator->GetGameNameShort(), i);
+
+		//every unit includes the PCH first, so it can be compiled on its own or with /Yu
+		std::ofstream os(path / "SDK" / unitName);
+
+		os << tfm::format("// %s (%s) SDK\n\n", generator->GetGameName(), generator->GetGameVersion())
+			<< "#include \"" << pchName << "\"\n\n";
+		for (auto&& file : units[i].Files)
+		{
+			os << "#include \"" << file << "\"\n";
+		}
+
+		list << "SDK/" << unitName << "\n";
+
+		Logger::Log("Unity unit %s: %d packages, ~%d lines", unitName, units[i].Files.size(), units[i].Lines);
+	}
+}
+
+/// <summary>
+/// Checks the saved reflection database with the reader and measures the lookup of every struct by name.
+/// </summary>
+/// <param name="file">The database file.</param>
+/// <returns>true if the database is valid, false if it is not.</returns>
+bool CheckReflectionDatabase(const fs::path& file)
+{
+	using namespace std::chrono;
+
+	std::ifstream is(file, std::ios::binary);
+	std::vector<char> data((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+
+	ReflectionDatabaseReader reader;
+	if (!reader.Open(data.data(), data.size()))
+	{
+		Logger::Error("Reflection database: %s is invalid", file.filename().string());
+		return false;
+	}
+
+	auto begin = high_resolution_clock::now();
+
+	size_t found = 0;
+	for (auto i = 0u; i < reader.GetStructCount(); ++i)
+	{
+		auto s = reader.GetStructRecord(i);
+		if (reader.FindStruct(reader.GetString(s->FullName)) == s)
+		{
+			++found;
+		}
+	}
+
+	auto elapsed = duration_cast<microseconds>(high_resolution_clock::now() - begin).count();
+
+	Logger::Log("Reflection database: %d bytes, %d objects, %d structs, %d enums", data.size(), reader.GetObjectCount(), reader.GetStructCount(), reader.GetEnumCount());
+	Logger::Log("Reflection database: %d of %d struct lookups succeeded in %d us", found, reader.GetStructCount(), elapsed);
+
+	return true;
+}
+
 /// <summary>
 /// Process the packages.
 /// </summary>
 /// <param name="path">The path where to create the package files.</param>
-void ProcessPackages(const fs::path& path)
+/// <returns>true if it succeeds, false if the reflection database or the offset table could not be saved.</returns>
+bool ProcessPackages(const fs::path& path)
 {
+	using namespace std::chrono;
+
+	struct StageStats
+	{
+		size_t Items = 0;
+		system_clock::duration Busy = system_clock::duration::zero();
+
+		void Add(system_clock::time_point begin)
+		{
+			++Items;
+			Busy += system_clock::now() - begin;
+		}
+	};
+
 	auto sdkPath = path / "SDK";
 	fs::create_directories(sdkPath);
+	if (generator->ShouldGenerateJson())
+	{
+		fs::create_directories(path / "JSON");
+	}
 	
 	std::unordered_set<UEObject> uniquePackages;
 	std::unordered_set<UEObject> excludePackage;
@@ -142,6 +657,81 @@ void ProcessPackages(const fs::path& path)
 
 	std::unordered_map<UEObject, bool> definedClasses;
 
+	//reflect (this thread) -> format -> write
+	//the stages only share the queues, Process is the only stage which touches packageOrder and definedClasses
+	BoundedQueue<std::unique_ptr<Package>> formatQueue(generator->GetPipelineQueueCapacity());
+	BoundedQueue<std::vector<Package::File>> writeQueue(generator->GetPipelineQueueCapacity());
+
+	StageStats reflectStats, formatStats, writeStats;
+
+	std::unique_ptr<ReflectionDatabaseWriter> database;
+	if (generator->ShouldGenerateReflectionDatabase())
+	{
+		database = std::make_unique<ReflectionDatabaseWriter>();
+		database->AddObjects();
+	}
+
+	std::unique_ptr<OffsetTableWriter> offsetTable;
+	auto offsetTableFile = path / tfm::format("%s_Offsets.bin", generator->GetGameNameShort());
+	if (generator->ShouldGenerateLiteSDK() && generator->ShouldGenerateOffsetTable())
+	{
+		offsetTable = std::make_unique<OffsetTableWriter>();
+		//keep the ids of the previous table, tools compiled against it can load the new table
+		if (offsetTable->Load(offsetTableFile))
+		{
+			Logger::Log("Offset table: loaded %d ids of %s", offsetTable->GetEntryCount(), offsetTableFile.filename().string());
+		}
+		else if (fs::exists(offsetTableFile))
+		{
+			Logger::Warning("Offset table: %s is invalid, the ids are assigned again", offsetTableFile.filename().string());
+		}
+	}
+
+	std::thread formatThread([&]()
+	{
+		std::unique_ptr<Package> package;
+		while (formatQueue.Pop(package))
+		{
+			auto begin = system_clock::now();
+
+			Profiler::Scope scope("Format", package->GetPackageObject().GetName());
+
+			std::vector<Package::File> files;
+			if (package->Format(sdkPath, files))
+			{
+				formatStats.Add(begin);
+
+				writeQueue.Push(std::move(files));
+			}
+			else
+			{
+				formatStats.Add(begin);
+
+				excludePackage.insert(package->GetPackageObject());
+			}
+
+			package.reset();
+		}
+
+		writeQueue.Close();
+	});
+
+	std::thread writeThread([&]()
+	{
+		std::vector<Package::File> files;
+		while (writeQueue.Pop(files))
+		{
+			auto begin = system_clock::now();
+
+			Profiler::Scope scope("Write");
+
+			Package::Write(files);
+			files.clear();
+
+			writeStats.Add(begin);
+		}
+	});
+
 	for (auto obj : ObjectsStore())
 	{
 		auto packageObj = obj.Object.GetPackageObject();
@@ -151,81 +741,247 @@ void ProcessPackages(const fs::path& path)
 			{
 				uniquePackages.insert(packageObj);
 
-				Package package(packageObj, packageOrder, definedClasses);
-				package.Process();
-				if (!package.Save(sdkPath))
+				auto begin = system_clock::now();
+
+				auto package = std::make_unique<Package>(packageObj, packageOrder, definedClasses);
+
+				Profiler::Scope scope("Process", packageObj.GetName());
+				if (generator->ShouldStreamPackages())
 				{
-					excludePackage.insert(packageObj);
+					package->EnableStreaming(sdkPath);
 				}
+				if (database)
+				{
+					package->EnableDatabase(*database);
+				}
+				if (offsetTable)
+				{
+					package->EnableOffsetTable(*offsetTable);
+				}
+				package->Process();
+
+				reflectStats.Add(begin);
+
+				formatQueue.Push(std::move(package));
 			}
 		}
 	}
 
+	formatQueue.Close();
+
+	formatThread.join();
+	writeThread.join();
+
+	auto logStage = [](const char* name, const StageStats& stats)
+	{
+		Logger::Log("Stage %-8s: %d packages, %d ms", name, stats.Items, duration_cast<milliseconds>(stats.Busy).count());
+	};
+	logStage("reflect", reflectStats);
+	logStage("format", formatStats);
+	logStage("write", writeStats);
+	Logger::Log("Format queue: max depth %d, average depth %.2f", formatQueue.GetMaxDepth(), formatQueue.GetAverageDepth());
+	Logger::Log("Write queue: max depth %d, average depth %.2f", writeQueue.GetMaxDepth(), writeQueue.GetAverageDepth());
+
 	//remove excluded (empty) packages
 	for (auto&& package : excludePackage)
 	{
 		packageOrder.erase(std::remove(std::begin(packageOrder), std::end(packageOrder), package), std::end(packageOrder));
 	}
 
-	SaveSDKHeader(path, definedClasses, packageOrder);
+	{
+		Profiler::Scope scope("SaveSDKHeader");
+
+		SaveSDKHeader(path, definedClasses, packageOrder);
+	}
+
+	if (generator->ShouldGenerateLiteSDK())
+	{
+		SaveLiteSDKHeader(path, packageOrder, offsetTable.get());
+	}
+
+	if (generator->GetUnityBuildUnitCount() != 0)
+	{
+		Profiler::Scope scope("SaveUnityBuild");
+
+		SaveUnityBuild(path, packageOrder);
+	}
+
+	auto succeeded = true;
+
+	if (database)
+	{
+		Profiler::Scope scope("SaveReflectionDatabase");
+
+		auto file = path / tfm::format("%s_Reflection.db", generator->GetGameNameShort());
+		if (!database->Save(file))
+		{
+			Logger::Error("Reflection database: failed to save %s", file.filename().string());
+			succeeded = false;
+		}
+		else if (!CheckReflectionDatabase(file))
+		{
+			succeeded = false;
+		}
+	}
+
+	if (offsetTable)
+	{
+		Profiler::Scope scope("SaveOffsetTable");
+
+		if (offsetTable->Save(offsetTableFile))
+		{
+			Logger::Log("Offset table: %d entries, %d not found in this build", offsetTable->GetEntryCount(), offsetTable->GetMissingCount());
+		}
+		else
+		{
+			Logger::Error("Offset table: failed to save %s", offsetTableFile.filename().string());
+			succeeded = false;
+		}
+	}
+
+	return succeeded;
 }
 
-DWORD WINAPI OnAttach(LPVOID lpParameter)
+const char* GetExitCodeMessage(ExitCode code)
 {
-	if (!ObjectsStore::Initialize())
+	switch (code)
 	{
-		MessageBoxA(0, "ObjectsStore::Initialize failed", "Error", 0);
-		return -1;
+		case ExitCode::Success:
+			return "Finished!";
+		case ExitCode::InvalidArguments:
+			return "Invalid arguments";
+		case ExitCode::SourceFailed:
+			return "ObjectsStore::Initialize or NamesStore::Initialize failed";
+		case ExitCode::InitializeFailed:
+			return "Initialize failed";
+		case ExitCode::OutputFailed:
+			return "Failed to write the output";
 	}
-	if (!NamesStore::Initialize())
+	return "Unknown error";
+}
+
+ExitCode Generate(IMemorySource& source, void* module, bool writeTimings)
+{
+	if (!source.Install())
 	{
-		MessageBoxA(0, "NamesStore::Initialize failed", "Error", 0);
-		return -1;
+		return ExitCode::SourceFailed;
 	}
 
-	if (!generator->Initialize(lpParameter))
+	if (!generator->Initialize(module))
 	{
-		MessageBoxA(0, "Initialize failed", "Error", 0);
-		return -1;
+		return ExitCode::InitializeFailed;
 	}
 
 	fs::path outputDirectory(generator->GetOutputDirectory());
 	if (!outputDirectory.is_absolute())
 	{
-		char buffer[2048];
-		if (GetModuleFileNameA((HMODULE)lpParameter, buffer, sizeof(buffer)) == 0)
+		if (module != nullptr)
 		{
-			MessageBoxA(0, "GetModuleFileName failed", "Error", 0);
-			return -1;
-		}
+			char buffer[2048];
+			if (GetModuleFileNameA(static_cast<HMODULE>(module), buffer, sizeof(buffer)) == 0)
+			{
+				return ExitCode::OutputFailed;
+			}
 
-		outputDirectory = fs::path(buffer).remove_filename() / outputDirectory;
+			outputDirectory = fs::path(buffer).remove_filename() / outputDirectory;
+		}
+		else
+		{
+			outputDirectory = fs::current_path() / outputDirectory;
+		}
 	}
 
 	outputDirectory /= generator->GetGameNameShort();
-	fs::create_directories(outputDirectory);
+
+	std::error_code error;
+	fs::create_directories(outputDirectory, error);
 	
 	std::ofstream log(outputDirectory / "Generator.log");
+	if (!log)
+	{
+		return ExitCode::OutputFailed;
+	}
 	Logger::SetStream(&log);
 
+	Logger::Log("Source: %s", source.GetName());
+
+	auto begin = std::chrono::steady_clock::now();
+
+	//the optional outputs are still written if one of them fails, the run reports the failure at the end
+	auto succeeded = true;
+
+	if (generator->ShouldCaptureSnapshot())
+	{
+		Profiler::Scope scope("Capture");
+
+		auto objectCount = ObjectsStore::Capture(generator->GetThreadCount());
+		auto nameCount = NamesStore::Capture(generator->GetThreadCount());
+
+		Logger::Log("Snapshot: captured %d objects and %d names in %d ms", objectCount, nameCount, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin).count());
+	}
+
+	if (generator->ShouldSaveSnapshotFile())
+	{
+		Profiler::Scope scope("SaveSnapshotFile");
+
+		SyntheticUniverse universe;
+		universe.Capture();
+
+		const auto file = outputDirectory / (generator->GetGameNameShort() + "_Snapshot.bin");
+		if (universe.Save(file))
+		{
+			Logger::Log("Snapshot file: saved %d objects and %d names", universe.GetObjects().size(), universe.GetNames().size());
+		}
+		else
+		{
+			Logger::Error("Snapshot file: failed to save %s", file.filename().string());
+			succeeded = false;
+		}
+	}
+
 	if (generator->ShouldDumpArrays())
 	{
+		Profiler::Scope scope("Dump");
+
 		Dump(outputDirectory);
 	}
 
 	fs::create_directories(outputDirectory);
 
-	auto begin = std::chrono::system_clock::now();
+	{
+		Profiler::Scope scope("ProcessPackages");
+
+		succeeded = ProcessPackages(outputDirectory) && succeeded;
+	}
 
-	ProcessPackages(outputDirectory);
+	Logger::Log("Finished, took %d ms.", std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin).count());
 
-	Logger::Log("Finished, took %d seconds.", std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now() - begin).count());
+	if (writeTimings)
+	{
+		Profiler::LogSummary();
+		if (!Profiler::SaveTrace(outputDirectory / "Generator.trace.json"))
+		{
+			Logger::Error("Failed to save the trace file");
+			succeeded = false;
+		}
+	}
 
 	Logger::SetStream(nullptr);
 
-	MessageBoxA(0, "Finished!", "Info", 0);
+	return succeeded ? ExitCode::Success : ExitCode::OutputFailed;
+}
+
+//the command line driver and the benchmark bring their own entry point
+#ifndef GENERATOR_EXECUTABLE
+DWORD WINAPI OnAttach(LPVOID lpParameter)
+{
+	ProcessMemorySource source;
+
+	auto result = Generate(source, lpParameter, true);
+
+	MessageBoxA(0, GetExitCodeMessage(result), result == ExitCode::Success ? "Info" : "Error", 0);
 
-	return 0;
+	return result == ExitCode::Success ? 0 : -1;
 }
 
 BOOL WINAPI DllMain(HMODULE hModule, DWORD dwReason, LPVOID lpReserved)
@@ -242,3 +998,4 @@ BOOL WINAPI DllMain(HMODULE hModule, DWORD dwReason, LPVOID lpReserved)
 
 	return FALSE;
 }
+#endif
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <string>
+
+#include "ObjectsStore.hpp"
+#include "NamesStore.hpp"
+#include "SyntheticUniverse.hpp"
+
+/// <summary>
+/// The memory the objects and names stores read from.
+/// </summary>
+class IMemorySource
+{
+public:
+	virtual ~IMemorySource() = default;
+
+	/// <summary>
+	/// Gets the name of the source for the log.
+	/// </summary>
+	/// <returns>The name.</returns>
+	virtual std::string GetName() const = 0;
+
+	/// <summary>
+	/// Initializes the objects and names stores with the objects and names of this source.
+	/// </summary>
+	/// <returns>true if it succeeds, false if it fails.</returns>
+	virtual bool Install() = 0;
+};
+
+/// <summary>
+/// The objects and names of the game the generator is loaded into.
+/// </summary>
+class ProcessMemorySource : public IMemorySource
+{
+public:
+	virtual std::string GetName() const override
+	{
+		return "process";
+	}
+
+	virtual bool Install() override
+	{
+		return ObjectsStore::Initialize() && NamesStore::Initialize();
+	}
+};
+
+/// <summary>
+/// A generated universe (see <see cref="SyntheticUniverse" />). Only available for targets which implement <see cref="SyntheticUniverse::Install()" />.
+/// </summary>
+class SyntheticMemorySource : public IMemorySource
+{
+public:
+	explicit SyntheticMemorySource(const SyntheticUniverse::Options& _options)
+		: options(_options)
+	{
+	}
+
+	virtual std::string GetName() const override
+	{
+		return "synthetic:" + std::to_string(options.ObjectCount) + ":" + std::to_string(options.Seed);
+	}
+
+	virtual bool Install() override
+	{
+		return SyntheticUniverse(options).Install();
+	}
+
+private:
+	SyntheticUniverse::Options options;
+};
+
+/// <summary>
+/// A snapshot file which was saved by the generator (see <see cref="IGenerator::ShouldSaveSnapshotFile()" />).
+/// The universe is installed like a generated one, so only targets which implement <see cref="SyntheticUniverse::Install()" /> can read it.
+/// </summary>
+class SnapshotMemorySource : public IMemorySource
+{
+public:
+	explicit SnapshotMemorySource(const fs::path& _file)
+		: file(_file)
+	{
+	}
+
+	virtual std::string GetName() const override
+	{
+		return "snapshot:" + file.string();
+	}
+
+	virtual bool Install() override
+	{
+		SyntheticUniverse universe;
+		return universe.Load(file) && universe.Install();
+	}
+
+private:
+	fs::path file;
+};
@@ -1,4 +1,193 @@
 #include "NamesStore.hpp"
+#include "Profiler.hpp"
+#include "ParallelFor.hpp"
+
+#include <mutex>
+#include <memory>
+#include <cstring>
+#include <unordered_map>
+
+namespace
+{
+	std::mutex cacheMutex;
+	StringPool namePool(1024 * 1024);
+	std::vector<PooledString> names;
+	std::vector<bool> decoded;
+	std::unordered_map<uint64_t, PooledString> displayNames;
+
+	std::once_flag nameIndexFlag;
+	std::unordered_map<std::string, size_t> nameIndex;
+
+	//the snapshot of NamesStore::Capture, it is read-only after the capture and needs no lock
+	std::vector<PooledString> capturedNames;
+	std::vector<uint8_t> capturedValid;
+	std::vector<std::unique_ptr<StringPool>> capturedPools;
+
+	/// <summary>
+	/// The number of names per capture chunk. It matches the chunk size of the UE4 name array, so every worker reads a single chunk.
+	/// </summary>
+	const size_t CaptureChunkSize = 16384;
+
+	bool IsValidName(const NamesStore& store, size_t id)
+	{
+		if (id < capturedValid.size())
+		{
+			return capturedValid[id] != 0;
+		}
+		return store.IsValid(id);
+	}
+}
+
+size_t NamesStore::Capture(size_t threadCount)
+{
+	NamesStore store;
+
+	auto count = store.GetNamesNum();
+	auto chunkCount = (count + CaptureChunkSize - 1) / CaptureChunkSize;
+
+	//every worker writes its own slice of the tables and its own pool
+	std::vector<PooledString> names(count);
+	std::vector<uint8_t> valid(count, 0);
+	std::vector<std::unique_ptr<StringPool>> pools(chunkCount);
+	std::vector<size_t> validCounts(chunkCount, 0);
+
+	ParallelForChunks(count, CaptureChunkSize, threadCount, [&](size_t chunk, size_t begin, size_t end)
+	{
+		pools[chunk] = std::make_unique<StringPool>(512 * 1024);
+
+		for (auto id = begin; id < end; ++id)
+		{
+			if (store.IsValid(id))
+			{
+				auto name = store.GetById(id);
+				names[id] = pools[chunk]->Store(name.c_str(), name.length());
+				valid[id] = 1;
+
+				++validCounts[chunk];
+			}
+		}
+	});
+
+	size_t validCount = 0;
+	for (auto n : validCounts)
+	{
+		validCount += n;
+	}
+
+	Profiler::Increment(Profiler::Counter::NamesDecoded, validCount);
+
+	capturedNames = std::move(names);
+	capturedValid = std::move(valid);
+	capturedPools = std::move(pools);
+
+	return validCount;
+}
+
+PooledString NamesStore::GetCachedById(size_t id) const
+{
+	if (id < capturedValid.size() && capturedValid[id] != 0)
+	{
+		return capturedNames[id];
+	}
+
+	std::lock_guard<std::mutex> lock(cacheMutex);
+
+	if (id >= names.size())
+	{
+		names.resize(id + 1);
+		decoded.resize(id + 1, false);
+	}
+
+	if (!decoded[id])
+	{
+		auto name = GetById(id);
+		names[id] = namePool.Store(name.c_str(), name.length());
+		decoded[id] = true;
+
+		Profiler::Increment(Profiler::Counter::NamesDecoded);
+	}
+
+	return names[id];
+}
+
+PooledString NamesStore::GetDisplayName(size_t id, int32_t number, bool stripPath) const
+{
+	auto key = (static_cast<uint64_t>(id) << 33) | (static_cast<uint64_t>(static_cast<uint32_t>(number)) << 1) | (stripPath ? 1 : 0);
+
+	{
+		std::lock_guard<std::mutex> lock(cacheMutex);
+
+		auto it = displayNames.find(key);
+		if (it != std::end(displayNames))
+		{
+			return it->second;
+		}
+	}
+
+	auto name = GetCachedById(id);
+	if (number <= 0 && !stripPath)
+	{
+		return name;
+	}
+
+	std::string displayName = name;
+	if (number > 0)
+	{
+		displayName += '_' + std::to_string(number);
+	}
+
+	if (stripPath)
+	{
+		auto pos = displayName.rfind('/');
+		if (pos != std::string::npos)
+		{
+			displayName = displayName.substr(pos + 1);
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(cacheMutex);
+
+	auto pooled = namePool.Store(displayName.c_str(), displayName.length());
+	displayNames[key] = pooled;
+
+	return pooled;
+}
+
+size_t NamesStore::FindId(const std::string& name) const
+{
+	std::call_once(nameIndexFlag, [this]()
+	{
+		nameIndex.reserve(GetNamesNum());
+
+		for (auto&& info : *this)
+		{
+			//keep the first id if a name is stored multiple times
+			nameIndex.emplace(info.Name, info.Index);
+		}
+	});
+
+	auto it = nameIndex.find(name);
+	if (it == std::end(nameIndex))
+	{
+		return InvalidId;
+	}
+	return it->second;
+}
+
+std::vector<bool> NamesStore::FindIdsContaining(const std::string& text) const
+{
+	std::vector<bool> ids(GetNamesNum(), false);
+
+	for (auto&& info : *this)
+	{
+		if (std::strstr(info.Name.c_str(), text.c_str()) != nullptr)
+		{
+			ids[info.Index] = true;
+		}
+	}
+
+	return ids;
+}
 
 NamesIterator NamesStore::begin()
 {
@@ -41,7 +230,7 @@ NamesIterator& NamesIterator::operator++()
 {
 	for (++index; index < store.GetNamesNum(); ++index)
 	{
-		if (store.IsValid(index))
+		if (IsValidName(store, index))
 		{
 			break;
 		}
@@ -68,10 +257,10 @@ bool NamesIterator::operator!=(const NamesIterator& rhs) const
 
 UENameInfo NamesIterator::operator*() const
 {
-	return { index, store.GetById(index) };
+	return { index, store.GetCachedById(index) };
 }
 
 UENameInfo NamesIterator::operator->() const
 {
-	return { index, store.GetById(index) };
+	return { index, store.GetCachedById(index) };
 }
\ No newline at end of file
@@ -1,8 +1,12 @@
 #pragma once
 
 #include <iterator>
+#include <cstdint>
+#include <string>
+#include <vector>
 
 #include "GenericTypes.hpp"
+#include "StringPool.hpp"
 
 class NamesIterator;
 
@@ -18,6 +22,23 @@ public:
 	/// <returns>true if it succeeds, false if it fails.</returns>
 	static bool Initialize();
 
+	/// <summary>
+	/// Initializes this object with names which were not created by the game (see SyntheticUniverse).
+	/// This method is only implemented by targets which support the synthetic universe.
+	/// </summary>
+	/// <param name="names">The names. The id of a name is its position in the list.</param>
+	/// <returns>true if it succeeds, false if it fails.</returns>
+	static bool Initialize(const std::vector<std::string>& names);
+
+	/// <summary>
+	/// Copies all current names into a snapshot. The name chunks are decoded in parallel into a string pool per chunk,
+	/// afterwards <see cref="GetCachedById()" /> reads the captured names without locking and without touching the game memory.
+	/// Names which are added later are still decoded on demand. Must not be called while other threads use the store.
+	/// </summary>
+	/// <param name="threadCount">The number of threads, 0 = one per hardware thread.</param>
+	/// <returns>The number of captured names.</returns>
+	static size_t Capture(size_t threadCount);
+
 	NamesIterator begin();
 
 	NamesIterator begin() const;
@@ -45,12 +66,46 @@ public:
 	/// <param name="id">The identifier.</param>
 	/// <returns>The name.</returns>
 	std::string GetById(size_t id) const;
+
+	/// <summary>
+	/// Gets a name by id. Every name gets decoded only once into the name table.
+	/// The returned string stays valid until the generator gets unloaded.
+	/// </summary>
+	/// <param name="id">The identifier.</param>
+	/// <returns>The name.</returns>
+	PooledString GetCachedById(size_t id) const;
+
+	/// <summary>
+	/// Gets the display name of an object name (Name_Number). Every display name gets built only once.
+	/// </summary>
+	/// <param name="id">The identifier.</param>
+	/// <param name="number">The instance number of the name. The number gets appended if it is greater than 0.</param>
+	/// <param name="stripPath">true to remove everything up to the last '/' (UE4 names).</param>
+	/// <returns>The display name.</returns>
+	PooledString GetDisplayName(size_t id, int32_t number, bool stripPath) const;
+
+	/// <summary>
+	/// Finds the id of a name. The index from name to id gets built once on the first call.
+	/// Names which are added after the index was built are not found.
+	/// </summary>
+	/// <param name="name">The name.</param>
+	/// <returns>The identifier or InvalidId if the name was not found.</returns>
+	size_t FindId(const std::string& name) const;
+
+	/// <summary>
+	/// Gets a lookup table of all names which contain the given text.
+	/// </summary>
+	/// <param name="text">The text to search.</param>
+	/// <returns>A table with an entry for every current name id. The entry is true if the name contains the text.</returns>
+	std::vector<bool> FindIdsContaining(const std::string& text) const;
+
+	static const size_t InvalidId = static_cast<size_t>(-1);
 };
 
 struct UENameInfo
 {
 	size_t Index;
-	std::string Name;
+	PooledString Name;
 };
 
 class NamesIterator : public std::iterator<std::forward_iterator_tag, UENameInfo>
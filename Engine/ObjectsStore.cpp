@@ -1,4 +1,75 @@
 #include "ObjectsStore.hpp"
+#include "Profiler.hpp"
+#include "ParallelFor.hpp"
+
+#include <algorithm>
+
+namespace
+{
+	//the snapshot of ObjectsStore::Capture, it is read-only after the capture
+	bool isCaptured = false;
+	std::vector<UEObject> capturedObjects;
+	/// <summary>The indices of the valid captured objects in ascending order.</summary>
+	std::vector<size_t> capturedIndices;
+
+	const size_t CaptureChunkSize = 16384;
+
+	/// <summary>
+	/// Gets the object index at a position of the snapshot.
+	/// </summary>
+	/// <param name="position">The position.</param>
+	/// <returns>The index or the number of captured objects if the position is the end.</returns>
+	size_t GetCapturedIndex(size_t position)
+	{
+		return position < capturedIndices.size() ? capturedIndices[position] : capturedObjects.size();
+	}
+}
+
+size_t ObjectsStore::Capture(size_t threadCount)
+{
+	ObjectsStore store;
+
+	auto count = store.GetObjectsNum();
+	auto chunkCount = (count + CaptureChunkSize - 1) / CaptureChunkSize;
+
+	//every worker writes its own slice of the objects and its own index list
+	std::vector<UEObject> objects(count);
+	std::vector<std::vector<size_t>> chunkIndices(chunkCount);
+
+	ParallelForChunks(count, CaptureChunkSize, threadCount, [&](size_t chunk, size_t begin, size_t end)
+	{
+		auto& indices = chunkIndices[chunk];
+		indices.reserve(end - begin);
+
+		for (auto index = begin; index < end; ++index)
+		{
+			objects[index] = store.GetById(index);
+			if (objects[index].IsValid())
+			{
+				indices.push_back(index);
+			}
+		}
+	});
+
+	size_t validCount = 0;
+	for (auto&& indices : chunkIndices)
+	{
+		validCount += indices.size();
+	}
+
+	std::vector<size_t> indices;
+	indices.reserve(validCount);
+	for (auto&& chunk : chunkIndices)
+	{
+		indices.insert(std::end(indices), std::begin(chunk), std::end(chunk));
+	}
+
+	capturedObjects = std::move(objects);
+	capturedIndices = std::move(indices);
+	isCaptured = true;
+
+	return validCount;
+}
 
 ObjectsIterator ObjectsStore::begin()
 {
@@ -34,27 +105,48 @@ UEClass ObjectsStore::FindClass(const std::string& name) const
 
 ObjectsIterator::ObjectsIterator(const ObjectsStore& _store)
 	: store(_store),
-	  index(_store.GetObjectsNum())
+	  index(isCaptured ? capturedObjects.size() : _store.GetObjectsNum()),
+	  position(capturedIndices.size())
 {
 }
 
 ObjectsIterator::ObjectsIterator(const ObjectsStore& _store, size_t _index)
 	: store(_store),
-	  index(_index)
+	  index(_index),
+	  position(0)
 {
+	if (isCaptured)
+	{
+		//start at the first valid object
+		position = std::lower_bound(std::begin(capturedIndices), std::end(capturedIndices), _index) - std::begin(capturedIndices);
+		index = GetCapturedIndex(position);
+	}
 }
 
 void ObjectsIterator::swap(ObjectsIterator& other) noexcept
 {
 	std::swap(index, other.index);
+	std::swap(position, other.position);
 }
 
 ObjectsIterator& ObjectsIterator::operator++()
 {
+	if (isCaptured)
+	{
+		index = GetCapturedIndex(++position);
+		if (position < capturedIndices.size())
+		{
+			Profiler::Increment(Profiler::Counter::ObjectsVisited);
+		}
+		return *this;
+	}
+
 	for (++index; index < store.GetObjectsNum(); ++index)
 	{
 		if (store.GetById(index).IsValid())
 		{
+			Profiler::Increment(Profiler::Counter::ObjectsVisited);
+
 			break;
 		}
 	}
@@ -80,10 +172,18 @@ bool ObjectsIterator::operator!=(const ObjectsIterator& rhs) const
 
 UEObjectInfo ObjectsIterator::operator*() const
 {
+	if (isCaptured)
+	{
+		return { index, capturedObjects[index] };
+	}
 	return { index, store.GetById(index) };
 }
 
 UEObjectInfo ObjectsIterator::operator->() const
 {
+	if (isCaptured)
+	{
+		return { index, capturedObjects[index] };
+	}
 	return { index, store.GetById(index) };
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <vector>
 #include <unordered_map>
 
 #include "GenericTypes.hpp"
@@ -18,6 +19,25 @@ public:
 	/// </returns>
 	static bool Initialize();
 
+	/// <summary>
+	/// Initializes this object with objects which were not created by the game (see SyntheticUniverse).
+	/// This method is only implemented by targets which support the synthetic universe.
+	/// </summary>
+	/// <param name="objects">The objects. The index of an object is its position in the list.</param>
+	/// <returns>
+	/// true if it succeeds, false if it fails.
+	/// </returns>
+	static bool Initialize(const std::vector<UObject*>& objects);
+
+	/// <summary>
+	/// Copies the object pointers of the current object array into a snapshot. The index range is copied in parallel chunks,
+	/// afterwards the iterators only visit the captured valid objects. <see cref="GetById()" /> still reads the object array.
+	/// Must not be called while other threads use the store.
+	/// </summary>
+	/// <param name="threadCount">The number of threads, 0 = one per hardware thread.</param>
+	/// <returns>The number of captured valid objects.</returns>
+	static size_t Capture(size_t threadCount);
+
 	ObjectsIterator begin();
 
 	ObjectsIterator begin() const;
@@ -91,6 +111,8 @@ class ObjectsIterator : public std::iterator<std::forward_iterator_tag, UEObject
 {
 	const ObjectsStore& store;
 	size_t index;
+	/// <summary>The position in the valid objects of the snapshot (see <see cref="ObjectsStore::Capture()" />).</summary>
+	size_t position;
 
 public:
 
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+/// <summary>
+/// The file format of the runtime offset table (XXX_Offsets.bin).
+/// Every member of the lite SDK gets a fixed id and the table maps the id to the offset of the member, so a tool which reads the offsets
+/// from the table (LITE_DYNAMIC_OFFSETS) keeps working with a table generated for a newer build of the game.
+/// The offsets directly follow the header, a lookup is a single indexed load. The name records behind the offsets are only used
+/// by the generator to keep the ids of the previous table, new members get appended.
+/// </summary>
+namespace OffsetTable
+{
+	const char Magic[8] = { 'U', 'E', 'S', 'D', 'K', 'O', 'T', '\0' };
+
+	const uint32_t Version = 1;
+
+	/// <summary>
+	/// The offset of a member which does not exist in this build.
+	/// </summary>
+	const uint32_t InvalidOffset = 0xFFFFFFFF;
+
+	/// <summary>
+	/// Marks a member which has no entry in the table.
+	/// </summary>
+	const uint32_t InvalidId = 0xFFFFFFFF;
+
+	struct Header
+	{
+		char Magic[8];
+		uint32_t Version;
+		/// <summary>The number of offsets and name records.</summary>
+		uint32_t EntryCount;
+		/// <summary>The byte offset of the name records.</summary>
+		uint32_t NamesOffset;
+		/// <summary>The byte offset of the null terminated strings.</summary>
+		uint32_t StringsOffset;
+		uint32_t StringsSize;
+		uint32_t Reserved;
+	};
+
+	struct NameRecord
+	{
+		/// <summary>The full name of the struct or class.</summary>
+		uint32_t Struct;
+		/// <summary>The name of the member.</summary>
+		uint32_t Member;
+	};
+
+	static_assert(sizeof(Header) == 32, "unexpected record size");
+	static_assert(sizeof(NameRecord) == 8, "unexpected record size");
+}
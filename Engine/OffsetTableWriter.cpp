@@ -0,0 +1,142 @@
+#include "OffsetTableWriter.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <cstring>
+#include <algorithm>
+
+using namespace OffsetTable;
+
+OffsetTableWriter::OffsetTableWriter()
+{
+	//offset 0 is the empty string
+	AddString(std::string());
+}
+
+uint32_t OffsetTableWriter::AddString(const std::string& str)
+{
+	auto it = stringOffsets.find(str);
+	if (it != std::end(stringOffsets))
+	{
+		return it->second;
+	}
+
+	auto offset = static_cast<uint32_t>(strings.size());
+	strings.append(str.c_str(), str.length() + 1);
+
+	stringOffsets.emplace(str, offset);
+
+	return offset;
+}
+
+bool OffsetTableWriter::Load(const fs::path& file)
+{
+	std::ifstream is(file, std::ios::binary);
+	if (!is)
+	{
+		return false;
+	}
+
+	std::vector<char> data((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+	if (data.size() < sizeof(Header))
+	{
+		return false;
+	}
+
+	auto header = reinterpret_cast<const Header*>(data.data());
+	if (std::memcmp(header->Magic, Magic, sizeof(Magic)) != 0 || header->Version != Version)
+	{
+		return false;
+	}
+	//computed in 64 bit, so a large entry count can not wrap around
+	if (header->NamesOffset < sizeof(Header) + static_cast<uint64_t>(header->EntryCount) * sizeof(uint32_t)
+		|| header->StringsOffset < header->NamesOffset + static_cast<uint64_t>(header->EntryCount) * sizeof(NameRecord)
+		|| header->StringsSize == 0
+		|| header->StringsOffset + static_cast<uint64_t>(header->StringsSize) > data.size()
+		|| data[header->StringsOffset + header->StringsSize - 1] != '\0')
+	{
+		return false;
+	}
+
+	auto records = reinterpret_cast<const NameRecord*>(data.data() + header->NamesOffset);
+	auto previousStrings = data.data() + header->StringsOffset;
+
+	//every record is checked before the writer is changed, so a corrupt table leaves the writer empty
+	for (auto i = 0u; i < header->EntryCount; ++i)
+	{
+		if (records[i].Struct >= header->StringsSize || records[i].Member >= header->StringsSize)
+		{
+			return false;
+		}
+	}
+
+	std::vector<uint32_t> loadedOffsets(header->EntryCount, InvalidOffset);
+	std::vector<OffsetTable::NameRecord> loadedNames(header->EntryCount);
+	std::unordered_map<std::string, uint32_t> loadedIds(header->EntryCount);
+
+	for (auto i = 0u; i < header->EntryCount; ++i)
+	{
+		std::string structName = previousStrings + records[i].Struct;
+		std::string memberName = previousStrings + records[i].Member;
+
+		loadedNames[i] = { AddString(structName), AddString(memberName) };
+		loadedIds[structName + "::" + memberName] = i;
+	}
+
+	offsets.swap(loadedOffsets);
+	names.swap(loadedNames);
+	ids.swap(loadedIds);
+
+	return true;
+}
+
+uint32_t OffsetTableWriter::Add(const std::string& structName, const std::string& memberName, size_t offset)
+{
+	auto key = structName + "::" + memberName;
+
+	auto it = ids.find(key);
+	if (it != std::end(ids))
+	{
+		offsets[it->second] = static_cast<uint32_t>(offset);
+
+		return it->second;
+	}
+
+	auto id = static_cast<uint32_t>(offsets.size());
+
+	offsets.push_back(static_cast<uint32_t>(offset));
+	names.push_back({ AddString(structName), AddString(memberName) });
+
+	ids.emplace(std::move(key), id);
+
+	return id;
+}
+
+size_t OffsetTableWriter::GetMissingCount() const
+{
+	return std::count(std::begin(offsets), std::end(offsets), InvalidOffset);
+}
+
+bool OffsetTableWriter::Save(const fs::path& file) const
+{
+	Header header = {};
+	std::memcpy(header.Magic, Magic, sizeof(Magic));
+	header.Version = Version;
+	header.EntryCount = static_cast<uint32_t>(offsets.size());
+	header.NamesOffset = static_cast<uint32_t>(sizeof(Header) + offsets.size() * sizeof(uint32_t));
+	header.StringsOffset = static_cast<uint32_t>(header.NamesOffset + names.size() * sizeof(NameRecord));
+	header.StringsSize = static_cast<uint32_t>(strings.size());
+
+	std::ofstream os(file, std::ios::binary);
+	if (!os)
+	{
+		return false;
+	}
+
+	os.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+	os.write(reinterpret_cast<const char*>(offsets.data()), static_cast<std::streamsize>(offsets.size() * sizeof(uint32_t)));
+	os.write(reinterpret_cast<const char*>(names.data()), static_cast<std::streamsize>(names.size() * sizeof(NameRecord)));
+	os.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+
+	return static_cast<bool>(os);
+}
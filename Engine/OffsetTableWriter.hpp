@@ -0,0 +1,76 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <filesystem>
+namespace fs = std::experimental::filesystem;
+
+#include "OffsetTable.hpp"
+
+/// <summary>
+/// Assigns the ids of the members and saves the runtime offset table (see OffsetTable.hpp).
+/// </summary>
+class OffsetTableWriter
+{
+public:
+	OffsetTableWriter();
+
+	/// <summary>
+	/// Loads the ids of a previously generated table. Members which exist in both builds keep their id,
+	/// members which do not get added again keep <see cref="OffsetTable::InvalidOffset" />.
+	/// </summary>
+	/// <param name="file">The previous table.</param>
+	/// <returns>true if it succeeds, false if the file does not exist or is invalid.</returns>
+	bool Load(const fs::path& file);
+
+	/// <summary>
+	/// Adds a member or updates the offset of an existing member.
+	/// </summary>
+	/// <param name="structName">The full name of the struct or class.</param>
+	/// <param name="memberName">The name of the member.</param>
+	/// <param name="offset">The offset of the member.</param>
+	/// <returns>The id of the member.</returns>
+	uint32_t Add(const std::string& structName, const std::string& memberName, size_t offset);
+
+	/// <summary>
+	/// Gets the number of entries.
+	/// </summary>
+	/// <returns>The number of entries.</returns>
+	size_t GetEntryCount() const
+	{
+		return offsets.size();
+	}
+
+	/// <summary>
+	/// Gets the number of entries of the previous table which got no offset in this build.
+	/// </summary>
+	/// <returns>The number of missing entries.</returns>
+	size_t GetMissingCount() const;
+
+	/// <summary>
+	/// Saves the table.
+	/// </summary>
+	/// <param name="file">The file to create.</param>
+	/// <returns>true if it succeeds, false if it fails.</returns>
+	bool Save(const fs::path& file) const;
+
+private:
+	/// <summary>
+	/// Adds a string to the string section. Every string is stored only once.
+	/// </summary>
+	/// <param name="str">The string.</param>
+	/// <returns>The offset of the string.</returns>
+	uint32_t AddString(const std::string& str);
+
+	std::string strings;
+	std::unordered_map<std::string, uint32_t> stringOffsets;
+
+	std::vector<uint32_t> offsets;
+	std::vector<OffsetTable::NameRecord> names;
+
+	/// <summary>
+	/// The ids by "struct::member".
+	/// </summary>
+	std::unordered_map<std::string, uint32_t> ids;
+};
@@ -1,6 +1,8 @@
 #include "Package.hpp"
 
 #include <fstream>
+#include <sstream>
+#include <algorithm>
 #include <unordered_set>
 #include "tinyformat.h"
 #include "cpplinq.hpp"
@@ -10,8 +12,13 @@
 #include "NameValidator.hpp"
 #include "PatternFinder.hpp"
 #include "ObjectsStore.hpp"
+#include "NamesStore.hpp"
 #include "Flags.hpp"
 #include "PrintHelper.hpp"
+#include "ReflectionDatabaseWriter.hpp"
+#include "OffsetTableWriter.hpp"
+#include "JsonWriter.hpp"
+#include "Profiler.hpp"
 
 /// <summary>
 /// Compare two properties.
@@ -31,11 +38,108 @@ bool ComparePropertyLess(const UEProperty& lhs, const UEProperty& rhs)
 	return lhs.GetOffset() < rhs.GetOffset();
 }
 
+/// <summary>
+/// Filters objects by texts which are contained in their name.
+/// The names are searched once when the filter gets created, afterwards the objects are tested by their name id.
+/// </summary>
+class NameFilter
+{
+public:
+	NameFilter(std::initializer_list<const char*> _texts)
+		: texts(_texts)
+	{
+		for (auto text : texts)
+		{
+			auto textIds = NamesStore().FindIdsContaining(text);
+			if (ids.size() < textIds.size())
+			{
+				ids.resize(textIds.size(), false);
+			}
+			for (auto i = 0u; i < textIds.size(); ++i)
+			{
+				if (textIds[i])
+				{
+					ids[i] = true;
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// Checks if the name of the object contains one of the texts.
+	/// </summary>
+	/// <param name="obj">The object.</param>
+	/// <returns>true if the name contains one of the texts.</returns>
+	bool Matches(const UEObject& obj) const
+	{
+		auto id = obj.GetNameId();
+		if (id < ids.size())
+		{
+			return ids[id];
+		}
+
+		//the name was added after the filter was created
+		auto name = obj.GetName();
+		for (auto text : texts)
+		{
+			if (name.find(text) != std::string::npos)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+private:
+	std::vector<const char*> texts;
+	std::vector<bool> ids;
+};
+
+struct Package::StreamState
+{
+	fs::path Path;
+	bool IsOpen;
+	bool HasContent;
+
+	std::ofstream Structs;
+	std::ofstream Classes;
+	std::ofstream Functions;
+	std::ofstream Offsets;
+
+	std::ofstream Json;
+	std::unique_ptr<JsonWriter> JsonStream;
+
+	std::vector<std::string> StructHeaders;
+	std::vector<std::string> ClassHeaders;
+};
+
 Package::Package(const UEObject& _packageObj, std::vector<UEObject>& _packageOrder, std::unordered_map<UEObject, bool>& _definedClasses)
 	: packageObj(_packageObj),
 	  packageOrder(_packageOrder),
-	  definedClasses(_definedClasses)
+	  definedClasses(_definedClasses),
+	  database(nullptr),
+	  offsetTable(nullptr)
+{
+}
+
+Package::~Package() = default;
+
+void Package::EnableStreaming(const fs::path& path)
+{
+	stream = std::make_unique<StreamState>();
+	stream->Path = path;
+	stream->IsOpen = false;
+	stream->HasContent = false;
+}
+
+void Package::EnableDatabase(ReflectionDatabaseWriter& writer)
+{
+	database = &writer;
+}
+
+void Package::EnableOffsetTable(OffsetTableWriter& writer)
 {
+	offsetTable = &writer;
 }
 
 void Package::Process()
@@ -66,11 +170,39 @@ void Package::Process()
 }
 
 bool Package::Save(const fs::path& path) const
+{
+	std::vector<File> files;
+	if (!Format(path, files))
+	{
+		return false;
+	}
+
+	Write(files);
+
+	return true;
+}
+
+bool Package::Format(const fs::path& path, std::vector<File>& files) const
 {
 	extern IGenerator* generator;
 
 	using namespace cpplinq;
 
+	auto stats = strings.GetStatistics();
+	Logger::Debug("Package strings: %-50s - %d strings (%d unique, %d bytes), %d allocations instead of %d",
+		packageObj.GetName(),
+		stats.InternCalls,
+		stats.UniqueStrings,
+		stats.Bytes,
+		stats.PoolAllocations,
+		stats.StringAllocations
+	);
+
+	if (stream)
+	{
+		return FinishStream();
+	}
+
 	//check if package is empty (no enums, structs or classes without members)
 	if (generator->ShouldGenerateEmptyFiles()
 		|| (from(enums) >> where([](auto&& e) { return !e.Values.empty(); }) >> any()
@@ -79,9 +211,40 @@ bool Package::Save(const fs::path& path) const
 		)
 	)
 	{
-		SaveStructs(path);
-		SaveClasses(path);
-		SaveMethods(path);
+		if (generator->ShouldGenerateHeaderPerClass())
+		{
+			SaveEnums(path, files);
+			SaveClassHeaders(path, files);
+		}
+		else
+		{
+			SaveStructs(path, files);
+			SaveClasses(path, files);
+		}
+		SaveMethods(path, files);
+
+		if (generator->ShouldGenerateJson())
+		{
+			SaveJson(path, files);
+		}
+
+		if (generator->ShouldGenerateLiteSDK())
+		{
+			SaveOffsets(path, files);
+
+			auto fileSize = [&](const char* type)
+			{
+				auto fileName = path / tfm::format("%s_%s_%s", generator->GetGameNameShort(), packageObj.GetName(), type);
+				auto it = std::find_if(std::begin(files), std::end(files), [&](auto&& f) { return f.Path == fileName; });
+				return it != std::end(files) ? it->Content.size() : 0;
+			};
+
+			Logger::Log("Lite Package: %-50s - %d bytes (full: %d bytes)",
+				packageObj.GetName(),
+				fileSize("offsets.hpp"),
+				fileSize("structs.hpp") + fileSize("classes.hpp") + fileSize("functions.cpp")
+			);
+		}
 
 		return true;
 	}
@@ -93,6 +256,240 @@ bool Package::Save(const fs::path& path) const
 	}
 }
 
+void Package::Write(const std::vector<File>& files)
+{
+	for (auto&& file : files)
+	{
+		std::ofstream os(file.Path);
+		os << file.Content;
+
+		Profiler::Increment(Profiler::Counter::BytesWritten, file.Content.size());
+	}
+}
+
+fs::path Package::GetStreamFileName(const char* type) const
+{
+	extern IGenerator* generator;
+
+	return stream->Path / tfm::format("%s_%s_%s", generator->GetGameNameShort(), packageObj.GetName(), type);
+}
+
+void Package::OpenStream() const
+{
+	extern IGenerator* generator;
+
+	if (stream->IsOpen)
+	{
+		return;
+	}
+	stream->IsOpen = true;
+
+	auto enumsInclude = tfm::format("\"%s_%s_enums.hpp\"", generator->GetGameNameShort(), packageObj.GetName());
+
+	//the enums are known after Process, so they get their own file
+	if (!generator->ShouldGenerateHeaderPerClass())
+	{
+		stream->Structs.open(GetStreamFileName("structs.hpp"));
+		PrintFileHeader(stream->Structs, { enumsInclude });
+		PrintSectionHeader(stream->Structs, "Script Structs");
+
+		stream->Classes.open(GetStreamFileName("classes.hpp"));
+		PrintFileHeader(stream->Classes, { enumsInclude });
+		PrintSectionHeader(stream->Classes, "Classes");
+	}
+
+	stream->Functions.open(GetStreamFileName("functions.cpp"));
+	PrintFileHeader(stream->Functions, { "\"../SDK.hpp\"" });
+	PrintSectionHeader(stream->Functions, "Functions");
+
+	if (generator->ShouldGenerateLiteSDK())
+	{
+		stream->Offsets.open(GetStreamFileName("offsets.hpp"));
+		PrintFileHeader(stream->Offsets);
+		stream->Offsets << "namespace Lite\n{\n\n";
+	}
+
+	if (generator->ShouldGenerateJson())
+	{
+		stream->Json.open(GetJsonFileName(stream->Path));
+		stream->JsonStream = std::make_unique<JsonWriter>(stream->Json);
+
+		auto& json = *stream->JsonStream;
+		json.BeginObject();
+		json.Key("Package");
+		json.String(packageObj.GetName());
+		json.Key("Structs");
+		json.BeginArray();
+	}
+}
+
+void Package::StreamStruct(const ScriptStruct& ss)
+{
+	extern IGenerator* generator;
+
+	OpenStream();
+
+	stream->HasContent |= !ss.Members.empty() || !ss.PredefinedMethods.empty();
+
+	if (generator->ShouldGenerateHeaderPerClass())
+	{
+		std::vector<File> files;
+		stream->StructHeaders.push_back(SaveClassHeader(stream->Path, ss, false, files));
+		Write(files);
+	}
+	else
+	{
+		PrintStruct(stream->Structs, ss);
+		stream->Structs << "\n";
+	}
+
+	PrintMethods(stream->Functions, ss);
+
+	if (generator->ShouldGenerateLiteSDK())
+	{
+		PrintOffsets(stream->Offsets, ss);
+		stream->Offsets << "\n";
+	}
+
+	if (stream->JsonStream)
+	{
+		PrintJson(*stream->JsonStream, ss, {}, false);
+	}
+}
+
+void Package::StreamClass(const Class& c)
+{
+	extern IGenerator* generator;
+
+	OpenStream();
+
+	stream->HasContent |= !c.Members.empty() || !c.PredefinedMethods.empty() || !c.Methods.empty();
+
+	if (generator->ShouldGenerateHeaderPerClass())
+	{
+		std::vector<File> files;
+		stream->ClassHeaders.push_back(SaveClassHeader(stream->Path, c, true, files));
+		Write(files);
+	}
+	else
+	{
+		PrintClass(stream->Classes, c);
+		stream->Classes << "\n";
+	}
+
+	PrintMethods(stream->Functions, c);
+
+	if (generator->ShouldGenerateLiteSDK())
+	{
+		PrintOffsets(stream->Offsets, c);
+		stream->Offsets << "\n";
+	}
+
+	if (stream->JsonStream)
+	{
+		PrintJson(*stream->JsonStream, c, c.Methods, true);
+	}
+}
+
+bool Package::FinishStream() const
+{
+	extern IGenerator* generator;
+
+	using namespace cpplinq;
+
+	stream->HasContent |= from(enums) >> where([](auto&& e) { return !e.Values.empty(); }) >> any();
+
+	if (!generator->ShouldGenerateEmptyFiles() && !stream->HasContent)
+	{
+		if (stream->IsOpen)
+		{
+			for (auto* os : { &stream->Structs, &stream->Classes, &stream->Functions, &stream->Offsets, &stream->Json })
+			{
+				os->close();
+			}
+			for (auto type : { "structs.hpp", "classes.hpp", "functions.cpp", "offsets.hpp" })
+			{
+				std::error_code ec;
+				fs::remove(GetStreamFileName(type), ec);
+			}
+			if (generator->ShouldGenerateJson())
+			{
+				std::error_code ec;
+				fs::remove(GetJsonFileName(stream->Path), ec);
+			}
+			for (auto&& header : stream->StructHeaders)
+			{
+				std::error_code ec;
+				fs::remove(stream->Path / header.substr(1, header.length() - 2), ec);
+			}
+			for (auto&& header : stream->ClassHeaders)
+			{
+				std::error_code ec;
+				fs::remove(stream->Path / header.substr(1, header.length() - 2), ec);
+			}
+		}
+
+		Logger::Log("skip empty Package: %s", packageObj.GetName());
+
+		return false;
+	}
+
+	OpenStream();
+
+	std::vector<File> files;
+	SaveEnums(stream->Path, files);
+
+	if (generator->ShouldGenerateHeaderPerClass())
+	{
+		SaveClassHeaderIncludes(stream->Path, stream->StructHeaders, stream->ClassHeaders, files);
+	}
+	else
+	{
+		PrintFileFooter(stream->Structs);
+		stream->Structs.close();
+
+		PrintFileFooter(stream->Classes);
+		stream->Classes.close();
+	}
+
+	Write(files);
+
+	PrintFileFooter(stream->Functions);
+	stream->Functions.close();
+
+	if (stream->JsonStream)
+	{
+		auto& json = *stream->JsonStream;
+		json.EndArray();
+		PrintJsonEnums(json);
+		json.EndObject();
+
+		stream->Json.close();
+	}
+
+	if (generator->ShouldGenerateLiteSDK())
+	{
+		stream->Offsets << "}\n\n";
+		PrintFileFooter(stream->Offsets);
+		stream->Offsets.close();
+
+		auto fileSize = [&](const char* type)
+		{
+			std::error_code ec;
+			auto size = fs::file_size(GetStreamFileName(type), ec);
+			return ec ? 0 : static_cast<size_t>(size);
+		};
+
+		Logger::Log("Lite Package: %-50s - %d bytes (full: %d bytes)",
+			packageObj.GetName(),
+			fileSize("offsets.hpp"),
+			fileSize("structs.hpp") + fileSize("classes.hpp") + fileSize("functions.cpp")
+		);
+	}
+
+	return true;
+}
+
 void Package::GenerateScriptStructPrerequisites(const UEScriptStruct& scriptStructObj)
 {
 	if (!scriptStructObj.IsValid())
@@ -100,10 +497,8 @@ void Package::GenerateScriptStructPrerequisites(const UEScriptStruct& scriptStru
 		return;
 	}
 
-	auto name = scriptStructObj.GetName();
-	if (name.find("Default__") != std::string::npos
-		|| name.find("<uninitialized>") != std::string::npos
-		|| name.find("PLACEHOLDER-CLASS") != std::string::npos)
+	static const NameFilter ignoredNames({ "Default__", "<uninitialized>", "PLACEHOLDER-CLASS" });
+	if (ignoredNames.Matches(scriptStructObj))
 	{
 		return;
 	}
@@ -193,14 +588,17 @@ void Package::GenerateMemberPrerequisites(const UEProperty& first)
 	}
 }
 
-Package::Member Package::Member::Unknown(size_t id, size_t offset, size_t size, std::string reason)
+Package::Member Package::Member::Unknown(size_t id, size_t offset, size_t size, PooledString reason)
 {
 	Member ss;
+	ss.MemberKind = Kind::Padding;
 	ss.Name = tfm::format("UnknownData%02d[0x%X]", id, size);
 	ss.Type = "unsigned char";
 	ss.Offset = offset;
 	ss.Size = size;
-	ss.Comment = std::move(reason);
+	ss.Flags = 0;
+	ss.Comment = reason;
+	ss.OffsetId = OffsetTable::InvalidId;
 	return ss;
 }
 
@@ -212,9 +610,9 @@ void Package::GenerateScriptStruct(const UEScriptStruct& scriptStructObj)
 	ss.Name = scriptStructObj.GetName();
 	ss.FullName = scriptStructObj.GetFullName();
 
-	Logger::Log("ScriptStruct: %-100s - instance: 0x%P", ss.Name, scriptStructObj.GetAddress());
+	Logger::Debug("ScriptStruct: %-100s - instance: 0x%P", ss.Name, scriptStructObj.GetAddress());
 
-	ss.NameCpp = MakeValidName(scriptStructObj.GetNameCPP());
+	ss.NameCpp = MakeUniqueCppName(scriptStructObj);
 	ss.NameCppFull = "struct ";
 
 	//some classes need special alignment
@@ -224,7 +622,7 @@ void Package::GenerateScriptStruct(const UEScriptStruct& scriptStructObj)
 		ss.NameCppFull += tfm::format("alignas(%d) ", alignment);
 	}
 
-	ss.NameCppFull += MakeUniqueCppName(scriptStructObj);
+	ss.NameCppFull += ss.NameCpp;
 
 	ss.Size = scriptStructObj.GetPropertySize();
 	ss.InheritedSize = 0;
@@ -256,9 +654,26 @@ void Package::GenerateScriptStruct(const UEScriptStruct& scriptStructObj)
 
 	GenerateMembers(scriptStructObj, offset, properties, ss.Members);
 
+	if (generator->ShouldGenerateHeaderPerClass())
+	{
+		GenerateHeaderDependencies(super != scriptStructObj ? super : UEStruct(), properties, ss.Dependencies);
+	}
+
 	generator->GetPredefinedClassMethods(scriptStructObj.GetFullName(), ss.PredefinedMethods);
 
-	scriptStructs.emplace_back(std::move(ss));
+	if (database)
+	{
+		AddToDatabase(scriptStructObj, ss, {});
+	}
+
+	if (stream)
+	{
+		StreamStruct(ss);
+	}
+	else
+	{
+		scriptStructs.emplace_back(std::move(ss));
+	}
 }
 
 void Package::GenerateEnum(const UEEnum& enumObj)
@@ -294,6 +709,11 @@ void Package::GenerateEnum(const UEEnum& enumObj)
 		}
 	}
 
+	if (database)
+	{
+		database->AddEnum(e.Name, e.FullName, packageObj.GetName(), e.Values);
+	}
+
 	enums.emplace_back(std::move(e));
 }
 
@@ -318,9 +738,8 @@ void Package::GenerateClassPrerequisites(const UEClass& classObj)
 		return;
 	}
 
-	auto name = classObj.GetName();
-	if (name.find("Default__") != std::string::npos
-		|| name.find("PLACEHOLDER-CLASS") != std::string::npos)
+	static const NameFilter ignoredNames({ "Default__", "PLACEHOLDER-CLASS" });
+	if (ignoredNames.Matches(classObj))
 	{
 		return;
 	}
@@ -382,7 +801,7 @@ void Package::GenerateClass(const UEClass& classObj)
 	c.Name = classObj.GetName();
 	c.FullName = classObj.GetFullName();
 
-	Logger::Log("Class:        %-100s - instance: 0x%P", c.Name, classObj.GetAddress());
+	Logger::Debug("Class:        %-100s - instance: 0x%P", c.Name, classObj.GetAddress());
 
 	c.NameCpp = MakeValidName(classObj.GetNameCPP());
 	c.NameCppFull = "class " + c.NameCpp;
@@ -406,10 +825,13 @@ void Package::GenerateClass(const UEClass& classObj)
 		for (auto&& prop : predefinedStaticMembers)
 		{
 			Member p;
+			p.MemberKind = Member::Kind::Predefined;
 			p.Offset = 0;
 			p.Size = 0;
+			p.Flags = 0;
+			p.OffsetId = OffsetTable::InvalidId;
 			p.Name = prop.Name;
-			p.Type = "static " + prop.Type;
+			p.Type = strings.Intern("static " + prop.Type);
 			c.Members.push_back(std::move(p));
 		}
 	}
@@ -420,13 +842,21 @@ void Package::GenerateClass(const UEClass& classObj)
 		for (auto&& prop : predefinedMembers)
 		{
 			Member p;
+			p.MemberKind = Member::Kind::Predefined;
 			p.Offset = 0;
 			p.Size = 0;
+			p.Flags = 0;
+			p.OffsetId = OffsetTable::InvalidId;
 			p.Name = prop.Name;
-			p.Type = prop.Type;
+			p.Type = strings.Intern(prop.Type);
 			p.Comment = "NOT AUTO-GENERATED PROPERTY";
 			c.Members.push_back(std::move(p));
 		}
+
+		if (generator->ShouldGenerateHeaderPerClass())
+		{
+			GenerateHeaderDependencies(super != classObj ? super : UEStruct(), {}, c.Dependencies);
+		}
 	}
 	else
 	{
@@ -451,6 +881,11 @@ void Package::GenerateClass(const UEClass& classObj)
 		std::sort(std::begin(properties), std::end(properties), ComparePropertyLess);
 
 		GenerateMembers(classObj, offset, properties, c.Members);
+
+		if (generator->ShouldGenerateHeaderPerClass())
+		{
+			GenerateHeaderDependencies(super != classObj ? super : UEStruct(), properties, c.Dependencies);
+		}
 	}
 
 	generator->GetPredefinedClassMethods(c.FullName, c.PredefinedMethods);
@@ -505,7 +940,19 @@ void Package::GenerateClass(const UEClass& classObj)
 		}
 	}
 
-	classes.emplace_back(std::move(c));
+	if (database)
+	{
+		AddToDatabase(classObj, c, c.Methods);
+	}
+
+	if (stream)
+	{
+		StreamClass(c);
+	}
+	else
+	{
+		classes.emplace_back(std::move(c));
+	}
 }
 
 void Package::GenerateMembers(const UEStruct& structObj, size_t offset, const std::vector<UEProperty>& properties, std::vector<Member>& members)
@@ -515,6 +962,12 @@ void Package::GenerateMembers(const UEStruct& structObj, size_t offset, const st
 	std::unordered_map<std::string, size_t> uniqueMemberNames;
 	size_t unknownDataCounter = 0;
 
+	std::string structName;
+	if (offsetTable)
+	{
+		structName = structObj.GetFullName();
+	}
+
 	for (auto& prop : properties)
 	{
 		if (offset < prop.GetOffset())
@@ -527,10 +980,11 @@ void Package::GenerateMembers(const UEStruct& structObj, size_t offset, const st
 		if (info.Type != UEProperty::PropertyType::Unknown)
 		{
 			Member sp;
+			sp.MemberKind = Member::Kind::Property;
 			sp.Offset = prop.GetOffset();
 			sp.Size = info.Size;
 
-			sp.Type = info.CppType;
+			sp.Type = strings.Intern(info.CppType);
 			sp.Name = MakeValidName(prop.GetName());
 
 			auto it = uniqueMemberNames.find(sp.Name);
@@ -555,7 +1009,14 @@ void Package::GenerateMembers(const UEStruct& structObj, size_t offset, const st
 			}
 
 			sp.Flags = static_cast<size_t>(prop.GetPropertyFlags());
-			sp.FlagsString = StringifyFlags(prop.GetPropertyFlags());
+			sp.FlagsString = strings.Intern(StringifyFlags(prop.GetPropertyFlags()));
+
+			sp.OffsetId = OffsetTable::InvalidId;
+			if (offsetTable)
+			{
+				//the table uses the name of the lite SDK without the array dimension and bitfield suffix
+				sp.OffsetId = offsetTable->Add(structName, sp.Name.substr(0, sp.Name.find_first_of(" [")), sp.Offset);
+			}
 
 			members.emplace_back(std::move(sp));
 
@@ -569,7 +1030,7 @@ void Package::GenerateMembers(const UEStruct& structObj, size_t offset, const st
 		{
 			auto info2 = prop.GetInfo();
 			auto size = prop.GetElementSize() * prop.GetArrayDim();
-			members.emplace_back(Member::Unknown(unknownDataCounter++, offset, size, "UNKNOWN PROPERTY: " + prop.GetFullName()));
+			members.emplace_back(Member::Unknown(unknownDataCounter++, offset, size, strings.Intern("UNKNOWN PROPERTY: " + prop.GetFullName())));
 		}
 
 		offset = prop.GetOffset() + (prop.GetElementSize() * prop.GetArrayDim());
@@ -585,57 +1046,152 @@ void Package::GenerateMembers(const UEStruct& structObj, size_t offset, const st
 	}
 }
 
-void Package::GenerateMethods(const UEClass& classObj, std::vector<Method>& methods) const
+void Package::GenerateHeaderDependencies(const UEStruct& super, const std::vector<UEProperty>& properties, std::vector<std::string>& dependencies) const
 {
-	extern IGenerator* generator;
+	std::unordered_set<std::string> unique;
 
-	//some classes (AnimBlueprintGenerated...) have multiple members with the same name, so filter them out
-	std::unordered_set<std::string> uniqueMethods;
-
-	for (auto prop = classObj.GetChildren().Cast<UEProperty>(); prop.IsValid(); prop = prop.GetNext().Cast<UEProperty>())
+	auto add = [&](const UEStruct& s)
 	{
-		if (prop.IsA<UEFunction>())
+		auto header = GetHeaderFileName(s);
+		if (unique.find(header) == std::end(unique))
 		{
-			auto function = prop.Cast<UEFunction>();
+			unique.insert(header);
+			dependencies.push_back(header);
+		}
+	};
 
-			Method m;
-			m.Index = function.GetIndex();
-			m.FullName = function.GetFullName();
-			m.Name = MakeValidName(function.GetName());
+	if (super.IsValid())
+	{
+		add(super);
+	}
 
-			if (uniqueMethods.find(m.FullName) != std::end(uniqueMethods))
+	//pointer members only need the forward declarations, structs (also inside of containers like TArray<FStruct>) need the full type
+	std::vector<UEProperty> pending;
+	for (auto&& first : properties)
+	{
+		pending.push_back(first);
+		while (!pending.empty())
+		{
+			auto prop = pending.back();
+			pending.pop_back();
+
+			auto info = prop.GetInfo();
+			if (info.Type == UEProperty::PropertyType::CustomStruct)
 			{
-				continue;
+				add(prop.Cast<UEStructProperty>().GetStruct());
 			}
-			uniqueMethods.insert(m.FullName);
-
-			m.IsNative = function.GetFunctionFlags() & UEFunctionFlags::FUNC_Native;
-			m.IsStatic = function.GetFunctionFlags() & UEFunctionFlags::FUNC_Static;
-			m.FlagsString = StringifyFlags(function.GetFunctionFlags());
-
-			std::vector<std::pair<UEProperty, Method::Parameter>> parameters;
-
-			std::unordered_map<std::string, size_t> unique;
-			for (auto param = function.GetChildren().Cast<UEProperty>(); param.IsValid(); param = param.GetNext().Cast<UEProperty>())
+			else if (info.Type == UEProperty::PropertyType::Container)
 			{
-				if (param.GetElementSize() == 0)
+				if (prop.IsA<UEArrayProperty>())
 				{
-					continue;
+					pending.push_back(prop.Cast<UEArrayProperty>().GetInner());
 				}
-
-				auto info = param.GetInfo();
-				if (info.Type != UEProperty::PropertyType::Unknown)
+				else if (prop.IsA<UEMapProperty>())
 				{
-					using Type = Method::Parameter::Type;
-
-					Method::Parameter p;
-
+					auto mapProp = prop.Cast<UEMapProperty>();
+					pending.push_back(mapProp.GetValueProperty());
+					pending.push_back(mapProp.GetKeyProperty());
+				}
+			}
+		}
+	}
+}
+
+void Package::AddToDatabase(const UEStruct& structObj, const ScriptStruct& ss, const std::vector<Method>& methods) const
+{
+	using namespace ReflectionDatabase;
+
+	database->AddStruct(structObj, ss.NameCpp, ss.Size, ss.InheritedSize);
+
+	for (auto&& m : ss.Members)
+	{
+		auto kind = m.MemberKind == Member::Kind::Property ? MemberKind::Property : m.MemberKind == Member::Kind::Padding ? MemberKind::Padding : MemberKind::Predefined;
+
+		database->AddMember(m.Name, m.Type, m.Offset, m.Size, m.Flags, kind, m.Comment);
+	}
+
+	for (auto&& m : methods)
+	{
+		database->AddFunction(m.Index, m.Name, m.FullName, m.Flags, m.ParmsSize);
+
+		for (auto&& p : m.Parameters)
+		{
+			auto kind = p.ParamType == Method::Parameter::Type::Default ? ParameterKind::Default : p.ParamType == Method::Parameter::Type::Out ? ParameterKind::Out : ParameterKind::Return;
+
+			database->AddParameter(p.Name, p.CppType, p.Offset, p.Size, p.Flags, kind);
+		}
+	}
+}
+
+std::string Package::GetHeaderFileName(const UEStruct& structObj)
+{
+	extern IGenerator* generator;
+
+	auto name = structObj.IsA<UEClass>() ? MakeValidName(structObj.GetNameCPP()) : MakeUniqueCppName(structObj);
+
+	return tfm::format("%s_%s_%s.hpp", generator->GetGameNameShort(), structObj.GetPackageObject().GetName(), name);
+}
+
+void Package::GenerateMethods(const UEClass& classObj, std::vector<Method>& methods)
+{
+	extern IGenerator* generator;
+
+	//some classes (AnimBlueprintGenerated...) have multiple members with the same name, so filter them out
+	std::unordered_set<std::string> uniqueMethods;
+
+	for (auto prop = classObj.GetChildren().Cast<UEProperty>(); prop.IsValid(); prop = prop.GetNext().Cast<UEProperty>())
+	{
+		if (prop.IsA<UEFunction>())
+		{
+			auto function = prop.Cast<UEFunction>();
+
+			Method m;
+			m.Index = function.GetIndex();
+			m.FullName = function.GetFullName();
+			m.Name = MakeValidName(function.GetName());
+
+			if (uniqueMethods.find(m.FullName) != std::end(uniqueMethods))
+			{
+				continue;
+			}
+			uniqueMethods.insert(m.FullName);
+
+			m.IsNative = function.GetFunctionFlags() & UEFunctionFlags::FUNC_Native;
+			m.IsStatic = function.GetFunctionFlags() & UEFunctionFlags::FUNC_Static;
+			m.HasOutParms = false;
+			m.ParmsSize = function.GetParmsSize();
+			m.Flags = static_cast<size_t>(function.GetFunctionFlags());
+			m.FlagsString = strings.Intern(StringifyFlags(function.GetFunctionFlags()));
+
+			std::vector<std::pair<UEProperty, Method::Parameter>> parameters;
+
+			std::unordered_map<std::string, size_t> unique;
+			for (auto param = function.GetChildren().Cast<UEProperty>(); param.IsValid(); param = param.GetNext().Cast<UEProperty>())
+			{
+				if (param.GetElementSize() == 0)
+				{
+					continue;
+				}
+
+				auto info = param.GetInfo();
+				if (info.Type != UEProperty::PropertyType::Unknown)
+				{
+					using Type = Method::Parameter::Type;
+
+					Method::Parameter p;
+
 					if (!Method::Parameter::MakeType(param.GetPropertyFlags(), p.ParamType))
 					{
 						//child isn't a parameter
 						continue;
 					}
 
+					if (param.GetPropertyFlags() & UEPropertyFlags::CPF_OutParm
+						&& !(param.GetPropertyFlags() & UEPropertyFlags::CPF_ReturnParm))
+					{
+						m.HasOutParms = true;
+					}
+
 					p.PassByReference = false;
 					p.Name = MakeValidName(param.GetName());
 
@@ -651,19 +1207,22 @@ void Package::GenerateMethods(const UEClass& classObj, std::vector<Method>& meth
 						p.Name += tfm::format("%02d", it->second);
 					}
 
-					p.FlagsString = StringifyFlags(param.GetPropertyFlags());
+					p.Flags = static_cast<size_t>(param.GetPropertyFlags());
+					p.FlagsString = strings.Intern(StringifyFlags(param.GetPropertyFlags()));
 
-					p.CppType = info.CppType;
-					if (param.IsA<UEBoolProperty>())
-					{
-						p.CppType = generator->GetOverrideType("bool");
-					}
+					p.Offset = param.GetOffset();
+					p.Size = param.GetElementSize() * param.GetArrayDim();
+
+					p.CppType = strings.Intern(param.IsA<UEBoolProperty>() ? generator->GetOverrideType("bool") : info.CppType);
+					p.StorageType = strings.Intern(info.CppType);
+					p.StorageSize = info.Size;
+					p.ArrayDim = param.GetArrayDim();
 					switch (p.ParamType)
 					{
 						case Type::Default:
-							if (prop.GetArrayDim() > 1)
+							if (param.GetArrayDim() > 1)
 							{
-								p.CppType = p.CppType + "*";
+								p.CppType = strings.Intern(p.CppType + "*");
 							}
 							else if (info.CanBeReference)
 							{
@@ -672,7 +1231,7 @@ void Package::GenerateMethods(const UEClass& classObj, std::vector<Method>& meth
 							break;
 					}
 
-					parameters.emplace_back(std::make_pair(prop, std::move(p)));
+					parameters.emplace_back(std::make_pair(param, std::move(p)));
 				}
 			}
 			
@@ -686,13 +1245,31 @@ void Package::GenerateMethods(const UEClass& classObj, std::vector<Method>& meth
 			methods.emplace_back(std::move(m));
 		}
 	}
+
+	//the batch variants need names which are not used by a reflected function (Foo_Batch may exist already)
+	std::unordered_set<std::string> usedNames;
+	for (auto&& m : methods)
+	{
+		usedNames.insert(m.Name);
+	}
+	for (auto&& m : methods)
+	{
+		m.BatchName = m.Name + "_Batch";
+		for (auto i = 1; usedNames.find(m.BatchName) != std::end(usedNames); ++i)
+		{
+			m.BatchName = tfm::format("%s_Batch%02d", m.Name, i);
+		}
+		usedNames.insert(m.BatchName);
+	}
 }
 
-void Package::SaveStructs(const fs::path& path) const
+void Package::SaveStructs(const fs::path& path, std::vector<File>& files) const
 {
 	extern IGenerator* generator;
 
-	std::ofstream os(path / tfm::format("%s_%s_structs.hpp", generator->GetGameNameShort(), packageObj.GetName()));
+	auto fileName = path / tfm::format("%s_%s_structs.hpp", generator->GetGameNameShort(), packageObj.GetName());
+
+	std::ostringstream os;
 
 	PrintFileHeader(os);
 
@@ -703,13 +1280,17 @@ void Package::SaveStructs(const fs::path& path) const
 	}
 
 	PrintFileFooter(os);
+
+	files.push_back({ fileName, os.str() });
 }
 
-void Package::SaveClasses(const fs::path& path) const
+void Package::SaveClasses(const fs::path& path, std::vector<File>& files) const
 {
 	extern IGenerator* generator;
 
-	std::ofstream os(path / tfm::format("%s_%s_classes.hpp", generator->GetGameNameShort(), packageObj.GetName()));
+	auto fileName = path / tfm::format("%s_%s_classes.hpp", generator->GetGameNameShort(), packageObj.GetName());
+
+	std::ostringstream os;
 
 	PrintFileHeader(os);
 
@@ -736,15 +1317,130 @@ void Package::SaveClasses(const fs::path& path) const
 	}
 
 	PrintFileFooter(os);
+
+	files.push_back({ fileName, os.str() });
+}
+
+void Package::SaveEnums(const fs::path& path, std::vector<File>& files) const
+{
+	extern IGenerator* generator;
+
+	auto fileName = path / tfm::format("%s_%s_enums.hpp", generator->GetGameNameShort(), packageObj.GetName());
+
+	std::ostringstream os;
+
+	PrintFileHeader(os);
+
+	if (!constants.empty())
+	{
+		PrintSectionHeader(os, "Constants");
+		for (auto&& c : constants) { PrintConstant(os, c); }
+
+		os << "\n";
+	}
+
+	if (!enums.empty())
+	{
+		PrintSectionHeader(os, "Enums");
+		for (auto&& e : enums) { PrintEnum(os, e); os << "\n"; }
+
+		os << "\n";
+	}
+
+	PrintFileFooter(os);
+
+	files.push_back({ fileName, os.str() });
+}
+
+std::string Package::SaveClassHeader(const fs::path& path, const ScriptStruct& s, bool isClass, std::vector<File>& files) const
+{
+	extern IGenerator* generator;
+
+	std::vector<std::string> includes = { tfm::format("\"%s_fwd.hpp\"", generator->GetGameNameShort()) };
+	for (auto&& dependency : s.Dependencies)
+	{
+		includes.push_back("\"" + dependency + "\"");
+	}
+
+	std::ostringstream os;
+
+	PrintFileHeader(os, includes);
+
+	if (isClass)
+	{
+		PrintClass(os, static_cast<const Class&>(s));
+	}
+	else
+	{
+		PrintStruct(os, s);
+	}
+	os << "\n";
+
+	PrintFileFooter(os);
+
+	auto fileName = tfm::format("%s_%s_%s.hpp", generator->GetGameNameShort(), packageObj.GetName(), s.NameCpp);
+
+	files.push_back({ path / fileName, os.str() });
+
+	return "\"" + fileName + "\"";
+}
+
+void Package::SaveClassHeaders(const fs::path& path, std::vector<File>& files) const
+{
+	//the package files only include the single headers
+	std::vector<std::string> structHeaders;
+	for (auto&& s : scriptStructs)
+	{
+		structHeaders.push_back(SaveClassHeader(path, s, false, files));
+	}
+
+	std::vector<std::string> classHeaders;
+	for (auto&& c : classes)
+	{
+		classHeaders.push_back(SaveClassHeader(path, c, true, files));
+	}
+
+	SaveClassHeaderIncludes(path, structHeaders, classHeaders, files);
 }
 
-void Package::SaveMethods(const fs::path& path) const
+void Package::SaveClassHeaderIncludes(const fs::path& path, const std::vector<std::string>& structHeaders, const std::vector<std::string>& classHeaders, std::vector<File>& files) const
+{
+	extern IGenerator* generator;
+
+	auto fileName = [&](const char* type) { return tfm::format("%s_%s_%s.hpp", generator->GetGameNameShort(), packageObj.GetName(), type); };
+
+	{
+		std::ostringstream os;
+
+		PrintFileHeader(os, structHeaders);
+
+		PrintFileFooter(os);
+
+		files.push_back({ path / fileName("structs"), os.str() });
+	}
+	{
+		std::vector<std::string> includes = { "\"" + fileName("enums") + "\"" };
+		std::copy(std::begin(classHeaders), std::end(classHeaders), std::back_inserter(includes));
+
+		std::ostringstream os;
+
+		PrintFileHeader(os, includes);
+
+		PrintFileFooter(os);
+
+		files.push_back({ path / fileName("classes"), os.str() });
+	}
+}
+
+void Package::SaveMethods(const fs::path& path, std::vector<File>& files) const
 {
 	extern IGenerator* generator;
 
 	using namespace cpplinq;
 
-	std::ofstream os(path / tfm::format("%s_%s_functions.cpp", generator->GetGameNameShort(), packageObj.GetName()));
+	auto fileName = path / tfm::format("%s_%s_functions.cpp", generator->GetGameNameShort(), packageObj.GetName());
+
+	std::ostringstream os;
 
 	PrintFileHeader(os, { "\"../SDK.hpp\"" });
 
@@ -752,46 +1448,260 @@ void Package::SaveMethods(const fs::path& path) const
 
 	for (auto&& s : scriptStructs)
 	{
-		for (auto&& m : s.PredefinedMethods)
+		PrintMethods(os, s);
+	}
+
+	for (auto&& c : classes)
+	{
+		PrintMethods(os, c);
+	}
+
+	PrintFileFooter(os);
+
+	files.push_back({ fileName, os.str() });
+}
+
+void Package::SaveOffsets(const fs::path& path, std::vector<File>& files) const
+{
+	extern IGenerator* generator;
+
+	auto fileName = path / tfm::format("%s_%s_offsets.hpp", generator->GetGameNameShort(), packageObj.GetName());
+
+	std::ostringstream os;
+
+	//TMember and TPatchableMember
+	PrintFileHeader(os, { tfm::format("\"%s_Lite_Basic.hpp\"", generator->GetGameNameShort()) });
+
+	os << "namespace Lite\n{\n\n";
+
+	if (!scriptStructs.empty())
+	{
+		PrintSectionHeader(os, "Script Structs");
+		for (auto&& s : scriptStructs) { PrintOffsets(os, s); os << "\n"; }
+	}
+
+	if (!classes.empty())
+	{
+		PrintSectionHeader(os, "Classes");
+		for (auto&& c : classes) { PrintOffsets(os, c); os << "\n"; }
+	}
+
+	os << "}\n\n";
+
+	PrintFileFooter(os);
+
+	files.push_back({ fileName, os.str() });
+}
+
+void Package::PrintMethods(std::ostream& os, const ScriptStruct& ss) const
+{
+	for (auto&& m : ss.PredefinedMethods)
+	{
+		if (m.MethodType != IGenerator::PredefinedMethod::Type::Inline)
 		{
-			if (m.MethodType != IGenerator::PredefinedMethod::Type::Inline)
-			{
-				os << m.Body << "\n\n";
-			}
+			os << m.Body << "\n\n";
 		}
 	}
+}
 
-	for (auto&& c : classes)
+void Package::PrintMethods(std::ostream& os, const Class& c) const
+{
+	extern IGenerator* generator;
+
+	PrintMethods(os, static_cast<const ScriptStruct&>(c));
+
+	for (auto&& m : c.Methods)
 	{
-		for (auto&& m : c.PredefinedMethods)
+		//Method Info
+		os << "// " << m.FullName << "\n"
+			<< "// (" << m.FlagsString << ")\n";
+		if (!m.Parameters.empty())
 		{
-			if (m.MethodType != IGenerator::PredefinedMethod::Type::Inline)
+			os << "// Parameters:\n";
+			for (auto&& param : m.Parameters)
 			{
-				os << m.Body << "\n\n";
+				tfm::format(os, "// %-30s %-30s (%s)\n", param.CppType, param.Name, param.FlagsString);
 			}
 		}
-		
-		for (auto&& m : c.Methods)
+
+		os << "\n";
+		os << BuildMethodSignature(m, c.NameCpp, false) << "\n";
+		os << BuildMethodBody(m) << "\n\n";
+
+		if (generator->ShouldGenerateBatchMethods() && CanBuildBatchMethod(m))
 		{
-			//Method Info
 			os << "// " << m.FullName << "\n"
-				<< "// (" << m.FlagsString << ")\n";
-			if (!m.Parameters.empty())
+				<< "// Calls the function on every object and reuses the parameters for all calls.\n\n";
+
+			os << BuildBatchMethodSignature(m, c.NameCpp, false) << "\n";
+			os << BuildBatchMethodBody(m) << "\n\n";
+		}
+	}
+}
+
+void Package::SaveJson(const fs::path& path, std::vector<File>& files) const
+{
+	std::ostringstream os;
+
+	JsonWriter json(os);
+	json.BeginObject();
+
+	json.Key("Package");
+	json.String(packageObj.GetName());
+
+	json.Key("Structs");
+	json.BeginArray();
+	for (auto&& s : scriptStructs)
+	{
+		PrintJson(json, s, {}, false);
+	}
+	for (auto&& c : classes)
+	{
+		PrintJson(json, c, c.Methods, true);
+	}
+	json.EndArray();
+
+	PrintJsonEnums(json);
+
+	json.EndObject();
+
+	files.push_back({ GetJsonFileName(path), os.str() });
+}
+
+fs::path Package::GetJsonFileName(const fs::path& path) const
+{
+	extern IGenerator* generator;
+
+	return path.parent_path() / "JSON" / tfm::format("%s_%s.json", generator->GetGameNameShort(), packageObj.GetName());
+}
+
+void Package::PrintJson(JsonWriter& json, const ScriptStruct& ss, const std::vector<Method>& methods, bool isClass) const
+{
+	json.BeginObject();
+
+	json.Key("Name");
+	json.String(ss.Name);
+	json.Key("FullName");
+	json.String(ss.FullName);
+	json.Key("NameCpp");
+	json.String(ss.NameCpp);
+	json.Key("IsClass");
+	json.Bool(isClass);
+	json.Key("Size");
+	json.Number(ss.Size);
+	json.Key("InheritedSize");
+	json.Number(ss.InheritedSize);
+
+	json.Key("Members");
+	json.BeginArray();
+	for (auto&& m : ss.Members)
+	{
+		json.BeginObject();
+		json.Key("Name");
+		json.String(m.Name);
+		json.Key("Type");
+		json.String(m.Type.c_str(), m.Type.size());
+		json.Key("Offset");
+		json.Number(m.Offset);
+		json.Key("Size");
+		json.Number(m.Size);
+		json.Key("Flags");
+		json.Number(m.Flags);
+		if (m.MemberKind != Member::Kind::Property)
+		{
+			json.Key("Kind");
+			json.String(m.MemberKind == Member::Kind::Padding ? "Padding" : "Predefined");
+		}
+		if (!m.Comment.empty())
+		{
+			json.Key("Comment");
+			json.String(m.Comment.c_str(), m.Comment.size());
+		}
+		json.EndObject();
+	}
+	json.EndArray();
+
+	if (isClass)
+	{
+		json.Key("Methods");
+		json.BeginArray();
+		for (auto&& m : methods)
+		{
+			json.BeginObject();
+			json.Key("Name");
+			json.String(m.Name);
+			json.Key("FullName");
+			json.String(m.FullName);
+			json.Key("Index");
+			json.Number(m.Index);
+			json.Key("FunctionFlags");
+			json.Number(m.Flags);
+			json.Key("ParmsSize");
+			json.Number(m.ParmsSize);
+
+			json.Key("Parameters");
+			json.BeginArray();
+			for (auto&& p : m.Parameters)
 			{
-				os << "// Parameters:\n";
-				for (auto&& param : m.Parameters)
-				{
-					tfm::format(os, "// %-30s %-30s (%s)\n", param.CppType, param.Name, param.FlagsString);
-				}
+				json.BeginObject();
+				json.Key("Name");
+				json.String(p.Name);
+				json.Key("Type");
+				json.String(p.CppType.c_str(), p.CppType.size());
+				json.Key("Offset");
+				json.Number(p.Offset);
+				json.Key("Size");
+				json.Number(p.Size);
+				json.Key("Flags");
+				json.Number(p.Flags);
+				json.Key("Kind");
+				json.String(p.ParamType == Method::Parameter::Type::Default ? "Default" : p.ParamType == Method::Parameter::Type::Out ? "Out" : "Return");
+				json.EndObject();
 			}
+			json.EndArray();
 
-			os << "\n";
-			os << BuildMethodSignature(m, c.NameCpp, false) << "\n";
-			os << BuildMethodBody(m) << "\n\n";
+			json.EndObject();
 		}
+		json.EndArray();
 	}
 
-	PrintFileFooter(os);
+	json.EndObject();
+}
+
+void Package::PrintJsonEnums(JsonWriter& json) const
+{
+	json.Key("Enums");
+	json.BeginArray();
+	for (auto&& e : enums)
+	{
+		json.BeginObject();
+		json.Key("Name");
+		json.String(e.Name);
+		json.Key("FullName");
+		json.String(e.FullName);
+		json.Key("Values");
+		json.BeginArray();
+		for (auto&& v : e.Values)
+		{
+			json.String(v);
+		}
+		json.EndArray();
+		json.EndObject();
+	}
+	json.EndArray();
+
+	json.Key("Constants");
+	json.BeginArray();
+	for (auto&& c : constants)
+	{
+		json.BeginObject();
+		json.Key("Name");
+		json.String(c.first);
+		json.Key("Value");
+		json.String(c.second);
+		json.EndObject();
+	}
+	json.EndArray();
 }
 
 void Package::PrintConstant(std::ostream& os, const std::pair<std::string, std::string>& c) const
@@ -857,8 +1767,96 @@ void Package::PrintStruct(std::ostream& os, const ScriptStruct& ss) const
 	os << "};\n";
 }
 
+void Package::PrintOffsets(std::ostream& os, const ScriptStruct& ss) const
+{
+	static const std::unordered_set<std::string> accessorTypes = {
+		"bool", "char", "unsigned char", "int8_t", "uint8_t", "int16_t", "uint16_t", "int", "int32_t", "uint32_t", "int64_t", "uint64_t", "float", "double"
+	};
+
+	os << "// " << ss.FullName << "\n// ";
+	if (ss.InheritedSize)
+	{
+		tfm::format(os, "0x%04X (0x%04X - 0x%04X)\n", ss.Size - ss.InheritedSize, ss.Size, ss.InheritedSize);
+	}
+	else
+	{
+		tfm::format(os, "0x%04X\n", ss.Size);
+	}
+
+	os << "namespace " << ss.NameCpp << "\n{\n";
+	tfm::format(os, "\tconstexpr size_t Size = 0x%04X;\n", ss.Size);
+	tfm::format(os, "\tconstexpr size_t InheritedSize = 0x%04X;\n", ss.InheritedSize);
+
+	std::vector<std::pair<std::string, std::string>> accessors;
+	std::vector<std::pair<std::string, uint32_t>> ids;
+
+	os << "\n\tnamespace Offsets\n\t{\n";
+	for (auto&& m : ss.Members)
+	{
+		//skip padding, static and predefined members
+		if (m.Size == 0 || m.Name.compare(0, 11, "UnknownData") == 0)
+		{
+			continue;
+		}
+
+		auto name = m.Name.substr(0, m.Name.find_first_of(" ["));
+
+		tfm::format(os, "\t\tconstexpr size_t %-50s = 0x%04X; // %s (0x%04X)\n", name, m.Offset, m.Type, m.Size);
+
+		if (m.OffsetId != OffsetTable::InvalidId)
+		{
+			ids.emplace_back(name, m.OffsetId);
+		}
+
+		//arrays and bitfields only get an offset
+		if (name.length() == m.Name.length() && name != "Size" && name != "InheritedSize" && name != "Offsets" && (ids.empty() || name != "Ids"))
+		{
+			if (accessorTypes.find(m.Type) != std::end(accessorTypes))
+			{
+				accessors.emplace_back(name, m.Type);
+			}
+			else if (!m.Type.empty() && m.Type.back() == '*')
+			{
+				accessors.emplace_back(name, "void*");
+			}
+		}
+	}
+	os << "\t}\n";
+
+	//the ids of the runtime offset table, the accessors read the offset from the table if the tool is compiled with LITE_DYNAMIC_OFFSETS
+	if (!ids.empty())
+	{
+		os << "\n\tnamespace Ids\n\t{\n";
+		for (auto&& id : ids)
+		{
+			tfm::format(os, "\t\tconstexpr uint32_t %-50s = %d;\n", id.first, id.second);
+		}
+		os << "\t}\n";
+	}
+
+	if (!accessors.empty())
+	{
+		os << "\n";
+		for (auto&& a : accessors)
+		{
+			if (!ids.empty())
+			{
+				tfm::format(os, "\tusing %-50s = TPatchableMember<%s, Offsets::%s, Ids::%s>;\n", a.first, a.second, a.first, a.first);
+			}
+			else
+			{
+				tfm::format(os, "\tusing %-50s = TMember<%s, Offsets::%s>;\n", a.first, a.second, a.first);
+			}
+		}
+	}
+
+	os << "}\n";
+}
+
 void Package::PrintClass(std::ostream& os, const Class& c) const
 {
+	extern IGenerator* generator;
+
 	using namespace cpplinq;
 	
 	os << "// " << c.FullName << "\n// ";
@@ -915,6 +1913,18 @@ void Package::PrintClass(std::ostream& os, const Class& c) const
 		{
 			os << "\t" << BuildMethodSignature(m, {}, true) << ";\n";
 		}
+
+		if (generator->ShouldGenerateBatchMethods())
+		{
+			os << "\n";
+			for (auto&& m : c.Methods)
+			{
+				if (CanBuildBatchMethod(m))
+				{
+					os << "\t" << BuildBatchMethodSignature(m, c.NameCpp, true) << ";\n";
+				}
+			}
+		}
 	}
 
 	os << "};\n\n";
@@ -962,17 +1972,63 @@ std::string Package::BuildMethodSignature(const Method& m, const std::string& cl
 	return ss.str();
 }
 
-std::string Package::BuildMethodBody(const Method& m) const
+std::string Package::BuildBatchMethodSignature(const Method& m, const std::string& className, bool inHeader) const
 {
-	extern IGenerator* generator;
+	using namespace cpplinq;
+	using Type = Method::Parameter::Type;
+
+	std::ostringstream ss;
+
+	if (inHeader)
+	{
+		ss << "static ";
+	}
+
+	ss << "void ";
+
+	if (!inHeader)
+	{
+		ss << className << "::";
+	}
+	ss << m.BatchName;
+
+	//Parameters
+	ss << "(class " << className << "* const* objects, size_t count";
 
+	auto retn = from(m.Parameters) >> where([](auto&& param) { return param.ParamType == Type::Return; });
+	if (retn >> any())
+	{
+		ss << ", " << (retn >> first()).CppType << "* results";
+	}
+
+	auto parameters = from(m.Parameters)
+		>> where([](auto&& param) { return param.ParamType == Type::Default; })
+		>> select([](auto&& param) { return (param.PassByReference ? "const " : "") + param.CppType + (param.PassByReference ? "& " : " ") + param.Name; });
+	if (parameters >> any())
+	{
+		ss << ", " << (parameters >> concatenate(", "));
+	}
+	ss << ")";
+
+	return ss.str();
+}
+
+bool Package::CanBuildBatchMethod(const Method& m) const
+{
 	using namespace cpplinq;
 	using Type = Method::Parameter::Type;
 
+	return !m.IsStatic
+		&& !(from(m.Parameters) >> where([](auto&& param) { return param.ParamType == Type::Out; }) >> any());
+}
+
+std::string Package::BuildMethodFunctionPointer(const Method& m) const
+{
+	extern IGenerator* generator;
+
 	std::ostringstream ss;
 
-	//Function Pointer
-	ss << "{\n\tstatic auto fn";
+	ss << "\tstatic auto fn";
 
 	if (generator->ShouldUseStrings())
 	{
@@ -994,45 +2050,152 @@ std::string Package::BuildMethodBody(const Method& m) const
 		ss << " = static_cast<UFunction*>(UObject::GetGlobalObjects().GetByIndex(" << m.Index << "));\n\n";
 	}
 
-	//Parameters
+	return ss.str();
+}
+
+std::string Package::BuildMethodParameters(const Method& m) const
+{
+	using namespace cpplinq;
+	using Type = Method::Parameter::Type;
+
+	std::ostringstream ss;
+
+	//Parameters (laid out like the reflected parameter frame)
+	//the members use the reflected storage types, the gaps and the tail of a member which is smaller than its reflected size get padded
 	ss << "\tstruct\n\t{\n";
+	size_t offset = 0;
+	size_t unknownDataCounter = 0;
 	for (auto&& param : m.Parameters)
 	{
-		tfm::format(ss, "\t\t%-30s %s;\n", param.CppType, param.Name);
+		if (offset < param.Offset)
+		{
+			tfm::format(ss, "\t\t%-30s %-30s // 0x%04X(0x%04X)\n", "unsigned char", tfm::format("UnknownData%02d[0x%X];", unknownDataCounter++, param.Offset - offset), offset, param.Offset - offset);
+		}
+
+		auto name = param.ArrayDim > 1 ? tfm::format("%s[0x%X]", param.Name, param.ArrayDim) : param.Name;
+		tfm::format(ss, "\t\t%-30s %-30s // 0x%04X(0x%04X)\n", param.StorageType, name + ";", param.Offset, param.Size);
+
+		auto end = param.Offset + param.StorageSize * param.ArrayDim;
+		if (offset < end)
+		{
+			offset = end;
+		}
+	}
+	if (offset < m.ParmsSize)
+	{
+		tfm::format(ss, "\t\t%-30s %-30s // 0x%04X(0x%04X)\n", "unsigned char", tfm::format("UnknownData%02d[0x%X];", unknownDataCounter++, m.ParmsSize - offset), offset, m.ParmsSize - offset);
 	}
 	ss << "\t} params;\n";
 
+	for (auto&& param : m.Parameters)
+	{
+		tfm::format(ss, "\tstatic_assert(offsetof(decltype(params), %s) == 0x%04X, \"%s\");\n", param.Name, param.Offset, param.Name);
+	}
+
 	auto default = from(m.Parameters) >> where([](auto&& param) { return param.ParamType == Type::Default; });
 	if (default >> any())
 	{
+		ss << "\n";
 		for (auto&& param : default >> experimental::container())
 		{
-			ss << "\tparams." << param.Name << " = " << param.Name << ";\n";
+			if (param.ArrayDim > 1)
+			{
+				tfm::format(ss, "\tfor (auto i = 0; i < 0x%X; ++i)\n\t\tparams.%s[i] = %s[i];\n", param.ArrayDim, param.Name, param.Name);
+			}
+			else
+			{
+				ss << "\tparams." << param.Name << " = " << param.Name << ";\n";
+			}
 		}
 	}
 
 	ss << "\n";
 
-	//Function Call
-	ss << "\tauto flags = fn->FunctionFlags;\n";
+	return ss.str();
+}
+
+std::string Package::BuildMethodCall(const Method& m, const std::string& context, const std::string& indent) const
+{
+	extern IGenerator* generator;
+
+	using namespace cpplinq;
+	using Type = Method::Parameter::Type;
+
+	std::ostringstream ss;
+
+	auto processEventIndent = indent;
+
+	auto directCall = m.IsNative && !m.HasOutParms && generator->ShouldCallNativeFunctionsDirectly();
+	if (directCall)
+	{
+		//the native thunk reads the parameters from the stack frame, so no need to patch the function flags
+		ss << indent << "if (native != nullptr)\n" << indent << "{\n";
+		ss << indent << "\t" << context << "CallNativeFunction(fn, native, &params, ";
+		auto retn = from(m.Parameters) >> where([](auto&& param) { return param.ParamType == Type::Return; });
+		if (retn >> any())
+		{
+			ss << "&params." << (retn >> first()).Name;
+		}
+		else
+		{
+			ss << "nullptr";
+		}
+		ss << ");\n";
+		ss << indent << "}\n" << indent << "else\n" << indent << "{\n";
+
+		processEventIndent += "\t";
+	}
+
+	ss << processEventIndent << "auto flags = fn->FunctionFlags;\n";
 	if (m.IsNative)
 	{
-		ss << "\tfn->FunctionFlags |= 0x" << tfm::format("%X", static_cast<std::underlying_type_t<UEFunctionFlags>>(UEFunctionFlags::FUNC_Native)) << ";\n";
+		ss << processEventIndent << "fn->FunctionFlags |= 0x" << tfm::format("%X", static_cast<std::underlying_type_t<UEFunctionFlags>>(UEFunctionFlags::FUNC_Native)) << ";\n";
 	}
 
 	ss << "\n";
 
+	ss << processEventIndent << context << "ProcessEvent(fn, &params);\n\n";
+
+	ss << processEventIndent << "fn->FunctionFlags = flags;\n";
+
+	if (directCall)
+	{
+		ss << indent << "}\n";
+	}
+
+	return ss.str();
+}
+
+std::string Package::BuildMethodBody(const Method& m) const
+{
+	extern IGenerator* generator;
+
+	using namespace cpplinq;
+	using Type = Method::Parameter::Type;
+
+	std::ostringstream ss;
+
+	//Function Pointer
+	ss << "{\n" << BuildMethodFunctionPointer(m);
+
+	//Parameters
+	ss << BuildMethodParameters(m);
+
+	//Function Call
+	std::string context = "UObject::";
 	if (m.IsStatic)
 	{
-		ss << "\tstatic auto defaultObj = StaticClass()->CreateDefaultObject();\n";
-		ss << "\tdefaultObj->ProcessEvent(fn, &params);\n\n";
+		ss << "\tstatic auto defaultObj = StaticClass()->CreateDefaultObject();\n\n";
+
+		context = "defaultObj->";
 	}
-	else
+
+	if (m.IsNative && !m.HasOutParms && generator->ShouldCallNativeFunctionsDirectly())
 	{
-		ss << "\tUObject::ProcessEvent(fn, &params);\n\n";
+		ss << "\tstatic auto native = fn->Func;\n\n";
 	}
 
-	ss << "\tfn->FunctionFlags = flags;\n";
+	ss << BuildMethodCall(m, context, "\t");
 
 	//Out Parameters
 	auto out = from(m.Parameters) >> where([](auto&& param) { return param.ParamType == Type::Out; });
@@ -1043,7 +2206,14 @@ std::string Package::BuildMethodBody(const Method& m) const
 		for (auto&& param : out >> experimental::container())
 		{
 			ss << "\tif (" << param.Name << " != nullptr)\n";
-			ss << "\t\t*" << param.Name << " = params." << param.Name << ";\n";
+			if (param.ArrayDim > 1)
+			{
+				tfm::format(ss, "\t\tfor (auto i = 0; i < 0x%X; ++i)\n\t\t\t%s[i] = params.%s[i];\n", param.ArrayDim, param.Name, param.Name);
+			}
+			else
+			{
+				ss << "\t\t*" << param.Name << " = params." << param.Name << ";\n";
+			}
 		}
 	}
 
@@ -1058,3 +2228,47 @@ std::string Package::BuildMethodBody(const Method& m) const
 
 	return ss.str();
 }
+
+std::string Package::BuildBatchMethodBody(const Method& m) const
+{
+	extern IGenerator* generator;
+
+	using namespace cpplinq;
+	using Type = Method::Parameter::Type;
+
+	std::ostringstream ss;
+
+	//Function Pointer
+	ss << "{\n" << BuildMethodFunctionPointer(m);
+
+	//Parameters (shared by all calls)
+	ss << BuildMethodParameters(m);
+
+	if (m.IsNative && !m.HasOutParms && generator->ShouldCallNativeFunctionsDirectly())
+	{
+		ss << "\tstatic auto native = fn->Func;\n\n";
+	}
+
+	//Function Calls
+	auto retn = from(m.Parameters) >> where([](auto&& param) { return param.ParamType == Type::Return; });
+
+	ss << "\tfor (size_t i = 0; i < count; ++i)\n\t{\n";
+	if (retn >> any())
+	{
+		//the frame is reused, so the return value of the previous call (FString, TArray...) must not leak into this one
+		ss << "\t\tparams." << (retn >> first()).Name << " = {};\n\n";
+	}
+	ss << BuildMethodCall(m, "objects[i]->", "\t\t");
+
+	//Return Values
+	if (retn >> any())
+	{
+		ss << "\n\t\tif (results != nullptr)\n";
+		ss << "\t\t\tresults[i] = params." << (retn >> first()).Name << ";\n";
+	}
+	ss << "\t}\n";
+
+	ss << "}\n";
+
+	return ss.str();
+}
\ No newline at end of file
@@ -2,10 +2,16 @@
 
 #include <vector>
 #include <unordered_map>
+#include <memory>
 #include <filesystem>
 namespace fs = std::experimental::filesystem;
 
 #include "GenericTypes.hpp"
+#include "StringPool.hpp"
+
+class ReflectionDatabaseWriter;
+class OffsetTableWriter;
+class JsonWriter;
 
 class Package
 {
@@ -19,11 +25,49 @@ public:
 	/// <param name="definedClasses">[in,out] The defined classes.</param>
 	Package(const UEObject& packageObj, std::vector<UEObject>& packageOrder, std::unordered_map<UEObject, bool>& definedClasses);
 
+	~Package();
+
+	/// <summary>
+	/// Enables the streaming mode (see <see cref="IGenerator::ShouldStreamPackages()" />).
+	/// Every struct and class gets written while the package is processed and is not kept in memory.
+	/// <see cref="Format()" /> writes the enums and finishes the files.
+	/// </summary>
+	/// <param name="path">The path to save to.</param>
+	void EnableStreaming(const fs::path& path);
+
+	/// <summary>
+	/// Adds every generated struct, class and enum to the reflection database (see <see cref="IGenerator::ShouldGenerateReflectionDatabase()" />).
+	/// </summary>
+	/// <param name="writer">The database writer. It must exist until <see cref="Process()" /> returns.</param>
+	void EnableDatabase(ReflectionDatabaseWriter& writer);
+
+	/// <summary>
+	/// Adds every member of the lite SDK to the runtime offset table (see <see cref="IGenerator::ShouldGenerateOffsetTable()" />).
+	/// </summary>
+	/// <param name="writer">The offset table writer. It must exist until <see cref="Process()" /> returns.</param>
+	void EnableOffsetTable(OffsetTableWriter& writer);
+
+	/// <summary>
+	/// Gets the package object.
+	/// </summary>
+	/// <returns>The package object.</returns>
+	const UEObject& GetPackageObject() const
+	{
+		return packageObj;
+	}
+
 	/// <summary>
 	/// Process the classes the package contains.
 	/// </summary>
 	void Process();
 
+	/// <summary>
+	/// Gets the file name of the header which contains a single struct or class (see <see cref="IGenerator::ShouldGenerateHeaderPerClass()" />).
+	/// </summary>
+	/// <param name="structObj">The struct or class object.</param>
+	/// <returns>The file name of the header.</returns>
+	static std::string GetHeaderFileName(const UEStruct& structObj);
+
 	/// <summary>
 	/// Saves the package classes as C++ code.
 	/// Files are only generated if there is code present or the generator forces the genertion of empty files.
@@ -32,6 +76,26 @@ public:
 	/// <returns>true if files got saved, else false.</returns>
 	bool Save(const fs::path& path) const;
 
+	struct File
+	{
+		fs::path Path;
+		std::string Content;
+	};
+
+	/// <summary>
+	/// Formats the package classes as C++ code without writing them to disk (see <see cref="Save()" />).
+	/// </summary>
+	/// <param name="path">The path to save to.</param>
+	/// <param name="files">[out] The formatted files.</param>
+	/// <returns>true if files got formatted, else false.</returns>
+	bool Format(const fs::path& path, std::vector<File>& files) const;
+
+	/// <summary>
+	/// Writes formatted files to disk.
+	/// </summary>
+	/// <param name="files">The files to write.</param>
+	static void Write(const std::vector<File>& files);
+
 private:
 
 	/// <summary>
@@ -80,24 +144,92 @@ private:
 	/// Saves the structures.
 	/// </summary>
 	/// <param name="path">The path to save to.</param>
-	void SaveStructs(const fs::path& path) const;
+	/// <param name="files">[out] The formatted files.</param>
+	void SaveStructs(const fs::path& path, std::vector<File>& files) const;
 
 	/// <summary>
 	/// Saves the classes.
 	/// </summary>
 	/// <param name="path">The path to save to.</param>
-	void SaveClasses(const fs::path& path) const;
+	/// <param name="files">[out] The formatted files.</param>
+	void SaveClasses(const fs::path& path, std::vector<File>& files) const;
+
+	/// <summary>
+	/// Saves the constants and enums.
+	/// </summary>
+	/// <param name="path">The path to save to.</param>
+	/// <param name="files">[out] The formatted files.</param>
+	void SaveEnums(const fs::path& path, std::vector<File>& files) const;
+
+	/// <summary>
+	/// Saves every structure and class in its own header.
+	/// </summary>
+	/// <param name="path">The path to save to.</param>
+	/// <param name="files">[out] The formatted files.</param>
+	void SaveClassHeaders(const fs::path& path, std::vector<File>& files) const;
 
 	/// <summary>
 	/// Saves the methods.
 	/// </summary>
 	/// <param name="path">The path to save to.</param>
-	void SaveMethods(const fs::path& path) const;
+	/// <param name="files">[out] The formatted files.</param>
+	void SaveMethods(const fs::path& path, std::vector<File>& files) const;
 
-	const UEObject& packageObj;
+	/// <summary>
+	/// Saves the package as JSON (see <see cref="IGenerator::ShouldGenerateJson()" />).
+	/// </summary>
+	/// <param name="path">The path to save to.</param>
+	/// <param name="files">[out] The formatted files.</param>
+	void SaveJson(const fs::path& path, std::vector<File>& files) const;
+
+	/// <summary>
+	/// Gets the path of the JSON file of the package. The file is stored in the JSON folder beside the SDK folder.
+	/// </summary>
+	/// <param name="path">The path of the SDK folder.</param>
+	/// <returns>The path of the file.</returns>
+	fs::path GetJsonFileName(const fs::path& path) const;
+
+	/// <summary>
+	/// Saves the offsets and sizes of the structures and classes (lite SDK).
+	/// </summary>
+	/// <param name="path">The path to save to.</param>
+	/// <param name="files">[out] The formatted files.</param>
+	void SaveOffsets(const fs::path& path, std::vector<File>& files) const;
+
+	UEObject packageObj;
 	std::vector<UEObject>& packageOrder;
 	std::unordered_map<UEObject, bool>& definedClasses;
 
+	/// <summary>
+	/// The type, flag and comment strings of the members and methods. They get released with the package.
+	/// </summary>
+	StringPool strings;
+
+	struct StreamState;
+	std::unique_ptr<StreamState> stream;
+
+	ReflectionDatabaseWriter* database;
+
+	OffsetTableWriter* offsetTable;
+
+	/// <summary>
+	/// Gets the path of a package file in streaming mode.
+	/// </summary>
+	/// <param name="type">The file type (Example: "classes.hpp").</param>
+	/// <returns>The path of the file.</returns>
+	fs::path GetStreamFileName(const char* type) const;
+
+	/// <summary>
+	/// Opens the package files in streaming mode and writes the file headers.
+	/// </summary>
+	void OpenStream() const;
+
+	/// <summary>
+	/// Finishes the package files in streaming mode and removes them if the package is empty.
+	/// </summary>
+	/// <returns>true if files got saved, else false.</returns>
+	bool FinishStream() const;
+
 	/// <summary>
 	/// Prints the c++ code of the constant.
 	/// </summary>
@@ -125,16 +257,29 @@ private:
 
 	struct Member
 	{
+		enum class Kind
+		{
+			Property,
+			Padding,
+			Predefined
+		};
+
+		Kind MemberKind;
 		std::string Name;
-		std::string Type;
+		PooledString Type;
 
 		size_t Offset;
 		size_t Size;
 
 		size_t Flags;
-		std::string FlagsString;
+		PooledString FlagsString;
 
-		std::string Comment;
+		PooledString Comment;
+
+		/// <summary>
+		/// The id of the member in the runtime offset table or OffsetTable::InvalidId.
+		/// </summary>
+		uint32_t OffsetId;
 
 		/// <summary>
 		/// Generates a padding member.
@@ -144,7 +289,7 @@ private:
 		/// <param name="size">The size.</param>
 		/// <param name="reason">The reason.</param>
 		/// <returns>A padding member.</returns>
-		static Member Unknown(size_t id, size_t offset, size_t size, std::string reason);
+		static Member Unknown(size_t id, size_t offset, size_t size, PooledString reason);
 	};
 
 	/// <summary>
@@ -156,6 +301,14 @@ private:
 	/// <param name="members">[out] The members of the struct or class.</param>
 	void GenerateMembers(const UEStruct& structObj, size_t offset, const std::vector<UEProperty>& properties, std::vector<Member>& members);
 
+	/// <summary>
+	/// Generates the header names of the base and the by-value members of a struct or class.
+	/// </summary>
+	/// <param name="super">The base struct or class.</param>
+	/// <param name="properties">The properties describing the members.</param>
+	/// <param name="dependencies">[out] The header names.</param>
+	void GenerateHeaderDependencies(const UEStruct& super, const std::vector<UEProperty>& properties, std::vector<std::string>& dependencies) const;
+
 	struct ScriptStruct
 	{
 		std::string Name;
@@ -169,6 +322,8 @@ private:
 		std::vector<Member> Members;
 
 		std::vector<IGenerator::PredefinedMethod> PredefinedMethods;
+
+		std::vector<std::string> Dependencies;
 	};
 
 	/// <summary>
@@ -180,6 +335,26 @@ private:
 
 	std::vector<ScriptStruct> scriptStructs;
 
+	/// <summary>
+	/// Writes the structure in streaming mode.
+	/// </summary>
+	/// <param name="ss">The structure to write.</param>
+	void StreamStruct(const ScriptStruct& ss);
+
+	/// <summary>
+	/// Prints the C++ code of the predefined methods of the structure.
+	/// </summary>
+	/// <param name="os">[in] The stream to print to.</param>
+	/// <param name="ss">The structure to print.</param>
+	void PrintMethods(std::ostream& os, const ScriptStruct& ss) const;
+
+	/// <summary>
+	/// Print the constexpr offsets, sizes and member accessors of the structure or class (lite SDK).
+	/// </summary>
+	/// <param name="os">[in] The stream to print to.</param>
+	/// <param name="ss">The structure to print.</param>
+	void PrintOffsets(std::ostream& os, const ScriptStruct& ss) const;
+
 	struct Method
 	{
 		struct Parameter
@@ -193,9 +368,23 @@ private:
 
 			Type ParamType;
 			bool PassByReference;
-			std::string CppType;
+			PooledString CppType;
 			std::string Name;
-			std::string FlagsString;
+			size_t Flags;
+			PooledString FlagsString;
+
+			size_t Offset;
+			size_t Size;
+
+			/// <summary>
+			/// The type of the parameter in the parameter struct. It has the reflected size, bools keep the storage type of the engine.
+			/// </summary>
+			PooledString StorageType;
+			/// <summary>
+			/// The size of <see cref="StorageType" />.
+			/// </summary>
+			size_t StorageSize;
+			size_t ArrayDim;
 
 			/// <summary>
 			/// Generates a valid type of the property flags.
@@ -208,11 +397,18 @@ private:
 
 		size_t Index;
 		std::string Name;
+		/// <summary>
+		/// The name of the batch variant of the method. It does not collide with the other methods of the class.
+		/// </summary>
+		std::string BatchName;
 		std::string FullName;
 		std::vector<Parameter> Parameters;
-		std::string FlagsString;
+		size_t ParmsSize;
+		size_t Flags;
+		PooledString FlagsString;
 		bool IsNative;
 		bool IsStatic;
+		bool HasOutParms;
 	};
 
 	/// <summary>
@@ -220,7 +416,7 @@ private:
 	/// </summary>
 	/// <param name="classObj">The class object.</param>
 	/// <param name="methods">[out] The methods of the class.</param>
-	void GenerateMethods(const UEClass& classObj, std::vector<Method>& methods) const;
+	void GenerateMethods(const UEClass& classObj, std::vector<Method>& methods);
 
 	/// <summary>
 	/// Builds the C++ method signature.
@@ -238,12 +434,77 @@ private:
 	/// <returns>The method body.</returns>
 	std::string BuildMethodBody(const Method& m) const;
 
+	/// <summary>
+	/// Builds the static function pointer lookup of a method body.
+	/// </summary>
+	/// <param name="m">The Method to process.</param>
+	/// <returns>The function pointer code.</returns>
+	std::string BuildMethodFunctionPointer(const Method& m) const;
+
+	/// <summary>
+	/// Builds the parameter struct of a method body and assigns the default parameters.
+	/// </summary>
+	/// <param name="m">The Method to process.</param>
+	/// <returns>The parameter code.</returns>
+	std::string BuildMethodParameters(const Method& m) const;
+
+	/// <summary>
+	/// Builds the call of the function with the parameter struct.
+	/// </summary>
+	/// <param name="m">The Method to process.</param>
+	/// <param name="context">The prefix of the call (Example: "UObject::").</param>
+	/// <param name="indent">The indentation of the code.</param>
+	/// <returns>The call code.</returns>
+	std::string BuildMethodCall(const Method& m, const std::string& context, const std::string& indent) const;
+
+	/// <summary>
+	/// Checks if a batch variant can be generated for the method (no static methods, no out parameters).
+	/// </summary>
+	/// <param name="m">The Method to check.</param>
+	/// <returns>true if a batch variant can be generated.</returns>
+	bool CanBuildBatchMethod(const Method& m) const;
+
+	/// <summary>
+	/// Builds the C++ signature of the batch variant of a method.
+	/// </summary>
+	/// <param name="m">The Method to process.</param>
+	/// <param name="className">Name of the class.</param>
+	/// <param name="inHeader">true if the signature is used as decleration.</param>
+	/// <returns>The method signature.</returns>
+	std::string BuildBatchMethodSignature(const Method& m, const std::string& className, bool inHeader) const;
+
+	/// <summary>
+	/// Builds the c++ body of the batch variant of a method.
+	/// </summary>
+	/// <param name="m">The Method to process.</param>
+	/// <returns>The method body.</returns>
+	std::string BuildBatchMethodBody(const Method& m) const;
+
 	struct Class : public ScriptStruct
 	{
 		std::vector<std::string> VirtualFunctions;
 		std::vector<Method> Methods;
 	};
 
+	/// <summary>
+	/// Saves a single structure or class header.
+	/// </summary>
+	/// <param name="path">The path to save to.</param>
+	/// <param name="s">The structure or class.</param>
+	/// <param name="isClass">true if the structure is a class.</param>
+	/// <param name="files">[out] The formatted files.</param>
+	/// <returns>The include of the header.</returns>
+	std::string SaveClassHeader(const fs::path& path, const ScriptStruct& s, bool isClass, std::vector<File>& files) const;
+
+	/// <summary>
+	/// Saves the structs and classes files which include the single headers.
+	/// </summary>
+	/// <param name="path">The path to save to.</param>
+	/// <param name="structHeaders">The includes of the structure headers.</param>
+	/// <param name="classHeaders">The includes of the class headers.</param>
+	/// <param name="files">[out] The formatted files.</param>
+	void SaveClassHeaderIncludes(const fs::path& path, const std::vector<std::string>& structHeaders, const std::vector<std::string>& classHeaders, std::vector<File>& files) const;
+
 	/// <summary>
 	/// Print the C++ code of the class.
 	/// </summary>
@@ -251,5 +512,41 @@ private:
 	/// <param name="c">The class to print.</param>
 	void PrintClass(std::ostream& os, const Class& c) const;
 
+	/// <summary>
+	/// Writes the class in streaming mode.
+	/// </summary>
+	/// <param name="c">The class to write.</param>
+	void StreamClass(const Class& c);
+
+	/// <summary>
+	/// Prints the C++ code of the methods of the class.
+	/// </summary>
+	/// <param name="os">[in] The stream to print to.</param>
+	/// <param name="c">The class to print.</param>
+	void PrintMethods(std::ostream& os, const Class& c) const;
+
 	std::vector<Class> classes;
+
+	/// <summary>
+	/// Writes the structure or class with its members and methods as JSON object.
+	/// </summary>
+	/// <param name="json">[in] The writer.</param>
+	/// <param name="ss">The structure or class to write.</param>
+	/// <param name="methods">The methods of the class.</param>
+	/// <param name="isClass">true if the structure is a class.</param>
+	void PrintJson(JsonWriter& json, const ScriptStruct& ss, const std::vector<Method>& methods, bool isClass) const;
+
+	/// <summary>
+	/// Writes the enums and constants of the package as JSON properties.
+	/// </summary>
+	/// <param name="json">[in] The writer.</param>
+	void PrintJsonEnums(JsonWriter& json) const;
+
+	/// <summary>
+	/// Adds a struct or class with its members and methods to the reflection database.
+	/// </summary>
+	/// <param name="structObj">The struct or class object.</param>
+	/// <param name="ss">The generated struct or class.</param>
+	/// <param name="methods">The methods of the class.</param>
+	void AddToDatabase(const UEStruct& structObj, const ScriptStruct& ss, const std::vector<Method>& methods) const;
 };
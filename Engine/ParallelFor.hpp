@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+/// <summary>
+/// Splits the index range [0, count) into chunks and processes the chunks on multiple threads.
+/// Every chunk is processed exactly once, the order of the chunks is not defined.
+/// </summary>
+/// <param name="count">The number of indices.</param>
+/// <param name="chunkSize">The number of indices per chunk.</param>
+/// <param name="threadCount">The number of threads, 0 = one per hardware thread.</param>
+/// <param name="process">The function which processes a chunk: process(chunk, begin, end).</param>
+template<typename Process>
+void ParallelForChunks(size_t count, size_t chunkSize, size_t threadCount, Process process)
+{
+	auto chunkCount = (count + chunkSize - 1) / chunkSize;
+	if (threadCount == 0)
+	{
+		threadCount = std::thread::hardware_concurrency();
+	}
+	threadCount = (std::max)(static_cast<size_t>(1), (std::min)(threadCount, chunkCount));
+
+	std::atomic<size_t> nextChunk(0);
+
+	auto worker = [&]()
+	{
+		for (auto chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++)
+		{
+			process(chunk, chunk * chunkSize, (std::min)(count, (chunk + 1) * chunkSize));
+		}
+	};
+
+	//the calling thread is one of the workers
+	std::vector<std::thread> threads;
+	for (auto i = 1u; i < threadCount; ++i)
+	{
+		threads.emplace_back(worker);
+	}
+	worker();
+
+	for (auto&& t : threads)
+	{
+		t.join();
+	}
+}
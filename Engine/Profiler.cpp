@@ -0,0 +1,229 @@
+#include "Profiler.hpp"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <unordered_map>
+
+#include "Logger.hpp"
+#include "JsonWriter.hpp"
+
+namespace
+{
+	using namespace std::chrono;
+
+	const char* counterNames[] = {
+		"Objects visited",
+		"IsA calls",
+		"GetFullName calls",
+		"GetInfo calls",
+		"Names decoded",
+		"Bytes written"
+	};
+	static_assert(sizeof(counterNames) / sizeof(counterNames[0]) == static_cast<size_t>(Profiler::Counter::Count), "missing counter name");
+
+	struct Event
+	{
+		const char* Name;
+		std::string Detail;
+		size_t Thread;
+		steady_clock::duration Begin;
+		steady_clock::duration Duration;
+	};
+
+	const auto start = steady_clock::now();
+
+	std::mutex counterMutex;
+	//the counters of the running threads and the sum of the counters of the finished threads
+	std::vector<std::atomic<uint64_t>*> threadCounters;
+	uint64_t finishedCounters[static_cast<size_t>(Profiler::Counter::Count)];
+
+	std::mutex eventMutex;
+	std::vector<Event> events;
+	std::unordered_map<std::thread::id, size_t> threadIds;
+
+	double ToMilliseconds(steady_clock::duration duration)
+	{
+		return duration_cast<microseconds>(duration).count() / 1000.0;
+	}
+}
+
+Profiler::ThreadCounters::ThreadCounters()
+{
+	for (auto&& value : Values)
+	{
+		value = 0;
+	}
+
+	std::lock_guard<std::mutex> lock(counterMutex);
+
+	threadCounters.push_back(Values);
+}
+
+Profiler::ThreadCounters::~ThreadCounters()
+{
+	std::lock_guard<std::mutex> lock(counterMutex);
+
+	for (auto i = 0u; i < static_cast<size_t>(Counter::Count); ++i)
+	{
+		finishedCounters[i] += Values[i].load(std::memory_order_relaxed);
+	}
+
+	threadCounters.erase(std::remove(std::begin(threadCounters), std::end(threadCounters), Values), std::end(threadCounters));
+}
+
+uint64_t Profiler::GetCounter(Counter counter)
+{
+	auto index = static_cast<size_t>(counter);
+
+	std::lock_guard<std::mutex> lock(counterMutex);
+
+	auto value = finishedCounters[index];
+	for (auto&& values : threadCounters)
+	{
+		value += values[index].load(std::memory_order_relaxed);
+	}
+	return value;
+}
+
+Profiler::Scope::Scope(const char* _name, std::string _detail)
+	: name(_name),
+	  detail(std::move(_detail)),
+	  begin(steady_clock::now())
+{
+}
+
+Profiler::Scope::~Scope()
+{
+	auto end = steady_clock::now();
+
+	std::lock_guard<std::mutex> lock(eventMutex);
+
+	//small thread numbers are easier to read in the trace viewer
+	auto it = threadIds.find(std::this_thread::get_id());
+	if (it == std::end(threadIds))
+	{
+		it = threadIds.emplace(std::this_thread::get_id(), threadIds.size() + 1).first;
+	}
+
+	events.push_back({ name, std::move(detail), it->second, begin - start, end - begin });
+}
+
+void Profiler::LogSummary()
+{
+	struct Summary
+	{
+		const char* Name;
+		size_t Calls;
+		steady_clock::duration Total;
+		steady_clock::duration Max;
+	};
+
+	std::vector<Summary> phases;
+	{
+		std::lock_guard<std::mutex> lock(eventMutex);
+
+		std::unordered_map<std::string, size_t> indices;
+		for (auto&& e : events)
+		{
+			auto it = indices.find(e.Name);
+			if (it == std::end(indices))
+			{
+				it = indices.emplace(e.Name, phases.size()).first;
+				phases.push_back({ e.Name, 0, steady_clock::duration::zero(), steady_clock::duration::zero() });
+			}
+
+			auto& phase = phases[it->second];
+			++phase.Calls;
+			phase.Total += e.Duration;
+			if (phase.Max < e.Duration)
+			{
+				phase.Max = e.Duration;
+			}
+		}
+	}
+
+	std::stable_sort(std::begin(phases), std::end(phases), [](auto&& lhs, auto&& rhs) { return lhs.Total > rhs.Total; });
+
+	Logger::Log("%-30s %10s %14s %14s", "Phase", "Calls", "Total ms", "Max ms");
+	for (auto&& phase : phases)
+	{
+		Logger::Log("%-30s %10d %14.3f %14.3f", phase.Name, phase.Calls, ToMilliseconds(phase.Total), ToMilliseconds(phase.Max));
+	}
+
+	Logger::Log("%-30s %10s", "Counter", "Value");
+	for (auto i = 0u; i < static_cast<size_t>(Counter::Count); ++i)
+	{
+		Logger::Log("%-30s %10d", counterNames[i], GetCounter(static_cast<Counter>(i)));
+	}
+}
+
+bool Profiler::SaveTrace(const fs::path& file)
+{
+	std::ofstream os(file);
+	if (!os)
+	{
+		return false;
+	}
+
+	JsonWriter json(os);
+	json.BeginObject();
+	json.Key("traceEvents");
+	json.BeginArray();
+
+	std::lock_guard<std::mutex> lock(eventMutex);
+
+	for (auto&& e : events)
+	{
+		json.BeginObject();
+		json.Key("name");
+		json.String(e.Name);
+		json.Key("ph");
+		json.String("X");
+		json.Key("pid");
+		json.Number(1);
+		json.Key("tid");
+		json.Number(e.Thread);
+		json.Key("ts");
+		json.Number(static_cast<uint64_t>(duration_cast<microseconds>(e.Begin).count()));
+		json.Key("dur");
+		json.Number(static_cast<uint64_t>(duration_cast<microseconds>(e.Duration).count()));
+		if (!e.Detail.empty())
+		{
+			json.Key("args");
+			json.BeginObject();
+			json.Key("detail");
+			json.String(e.Detail);
+			json.EndObject();
+		}
+		json.EndObject();
+	}
+
+	//the counters are shown as counter track at the end of the run
+	auto end = duration_cast<microseconds>(steady_clock::now() - start).count();
+	for (auto i = 0u; i < static_cast<size_t>(Counter::Count); ++i)
+	{
+		json.BeginObject();
+		json.Key("name");
+		json.String(counterNames[i]);
+		json.Key("ph");
+		json.String("C");
+		json.Key("pid");
+		json.Number(1);
+		json.Key("ts");
+		json.Number(static_cast<uint64_t>(end));
+		json.Key("args");
+		json.BeginObject();
+		json.Key("value");
+		json.Number(GetCounter(static_cast<Counter>(i)));
+		json.EndObject();
+		json.EndObject();
+	}
+
+	json.EndArray();
+	json.EndObject();
+
+	return static_cast<bool>(os);
+}
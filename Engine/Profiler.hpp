@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <filesystem>
+namespace fs = std::experimental::filesystem;
+
+/// <summary>
+/// Set to 0 to remove the counters at compile time. The phases are always measured.
+/// </summary>
+#ifndef PROFILER_COUNTERS
+#define PROFILER_COUNTERS 1
+#endif
+
+/// <summary>
+/// Collects the duration of the generator phases and counts expensive operations.
+/// The phases are written to the log as summary table and as Chrome trace events (chrome://tracing).
+/// </summary>
+class Profiler
+{
+public:
+	enum class Counter
+	{
+		ObjectsVisited,
+		IsACalls,
+		GetFullNameCalls,
+		GetInfoCalls,
+		NamesDecoded,
+		BytesWritten,
+
+		Count
+	};
+
+	/// <summary>
+	/// Increments a counter. This method can be called from any thread.
+	/// Every thread has its own counters (no atomic read-modify-write in hot paths like IsA), they get merged when the counters are read.
+	/// </summary>
+	/// <param name="counter">The counter.</param>
+	/// <param name="value">The value to add.</param>
+	static void Increment(Counter counter, uint64_t value = 1)
+	{
+#if PROFILER_COUNTERS
+		thread_local ThreadCounters threadCounters;
+
+		//only this thread writes the value, the atomic just makes the reads of the other threads safe
+		auto& c = threadCounters.Values[static_cast<size_t>(counter)];
+		c.store(c.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+#endif
+	}
+
+	/// <summary>
+	/// Gets the sum of a counter over all threads.
+	/// </summary>
+	/// <param name="counter">The counter.</param>
+	/// <returns>The value.</returns>
+	static uint64_t GetCounter(Counter counter);
+
+	/// <summary>
+	/// Measures the time until the scope ends and records it as phase.
+	/// </summary>
+	class Scope
+	{
+	public:
+		/// <summary>
+		/// Constructor.
+		/// </summary>
+		/// <param name="name">The name of the phase. Phases with the same name are summarized.</param>
+		/// <param name="detail">Additional information which is only shown in the trace (Example: the package name).</param>
+		explicit Scope(const char* name, std::string detail = std::string());
+
+		~Scope();
+
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+
+	private:
+		const char* name;
+		std::string detail;
+		std::chrono::steady_clock::time_point begin;
+	};
+
+	/// <summary>
+	/// Logs the summary table of the phases and the counters.
+	/// </summary>
+	static void LogSummary();
+
+	/// <summary>
+	/// Saves the phases and counters as Chrome trace event file.
+	/// </summary>
+	/// <param name="file">The file to create.</param>
+	/// <returns>true if it succeeds, false if it fails.</returns>
+	static bool SaveTrace(const fs::path& file);
+
+private:
+	/// <summary>
+	/// The counters of a thread. They register themselves on the first increment and add their values to the totals when the thread exits.
+	/// </summary>
+	struct ThreadCounters
+	{
+		ThreadCounters();
+		~ThreadCounters();
+
+		std::atomic<uint64_t> Values[static_cast<size_t>(Counter::Count)];
+	};
+};
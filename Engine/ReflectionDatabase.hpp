@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/// <summary>
+/// The file format of the binary reflection database (XXX_Reflection.db).
+/// The file consists of a header followed by sections of fixed-size records, so it can be used directly from a memory mapped view.
+/// All references are uint32_t indices into the referenced section. Strings are byte offsets into the string section.
+/// Only this header is needed to read the database (see ReflectionDatabaseReader.hpp).
+/// </summary>
+namespace ReflectionDatabase
+{
+	const char Magic[8] = { 'U', 'E', 'S', 'D', 'K', 'D', 'B', '\0' };
+
+	const uint32_t Version = 1;
+
+	/// <summary>
+	/// Marks a reference which does not point to a record.
+	/// </summary>
+	const uint32_t InvalidIndex = 0xFFFFFFFF;
+
+	enum class SectionType : uint32_t
+	{
+		/// <summary>Null terminated strings. Count is the size in bytes.</summary>
+		Strings,
+		/// <summary>ObjectRecord, ordered by the object index.</summary>
+		Objects,
+		/// <summary>StructRecord</summary>
+		Structs,
+		/// <summary>MemberRecord, grouped by struct.</summary>
+		Members,
+		/// <summary>FunctionRecord, grouped by struct.</summary>
+		Functions,
+		/// <summary>ParameterRecord, grouped by function.</summary>
+		Parameters,
+		/// <summary>EnumRecord</summary>
+		Enums,
+		/// <summary>EnumValueRecord, grouped by enum.</summary>
+		EnumValues,
+		/// <summary>uint32_t struct indices ordered by the full name of the struct.</summary>
+		StructsByName,
+
+		Count
+	};
+
+	struct Section
+	{
+		uint64_t Offset;
+		uint32_t Count;
+		uint32_t RecordSize;
+	};
+
+	struct Header
+	{
+		char Magic[8];
+		uint32_t Version;
+		uint32_t PointerSize;
+		uint32_t GameName;
+		uint32_t GameVersion;
+		Section Sections[static_cast<size_t>(SectionType::Count)];
+	};
+
+	struct ObjectRecord
+	{
+		uint64_t Address;
+		uint32_t Name;
+		/// <summary>The object index of the class.</summary>
+		uint32_t Class;
+		/// <summary>The object index of the outer.</summary>
+		uint32_t Outer;
+		uint32_t Reserved;
+	};
+
+	enum StructFlags : uint32_t
+	{
+		StructFlag_Class = 0x1
+	};
+
+	struct StructRecord
+	{
+		/// <summary>The object index of the struct.</summary>
+		uint32_t Object;
+		uint32_t Name;
+		uint32_t FullName;
+		uint32_t NameCpp;
+		uint32_t Package;
+		/// <summary>The struct index of the base struct.</summary>
+		uint32_t Super;
+		uint32_t Size;
+		uint32_t InheritedSize;
+		uint32_t FirstMember;
+		uint32_t MemberCount;
+		uint32_t FirstFunction;
+		uint32_t FunctionCount;
+		uint32_t Flags;
+		uint32_t Reserved;
+	};
+
+	enum class MemberKind : uint32_t
+	{
+		Property,
+		Padding,
+		Predefined
+	};
+
+	struct MemberRecord
+	{
+		uint64_t PropertyFlags;
+		uint32_t Name;
+		uint32_t Type;
+		uint32_t Offset;
+		uint32_t Size;
+		MemberKind Kind;
+		uint32_t Comment;
+	};
+
+	struct FunctionRecord
+	{
+		uint64_t FunctionFlags;
+		/// <summary>The object index of the function.</summary>
+		uint32_t Object;
+		uint32_t Name;
+		uint32_t FullName;
+		/// <summary>The struct index of the owning class.</summary>
+		uint32_t Struct;
+		uint32_t ParmsSize;
+		uint32_t FirstParameter;
+		uint32_t ParameterCount;
+		uint32_t Reserved;
+	};
+
+	enum class ParameterKind : uint32_t
+	{
+		Default,
+		Out,
+		Return
+	};
+
+	struct ParameterRecord
+	{
+		uint64_t PropertyFlags;
+		uint32_t Name;
+		uint32_t Type;
+		uint32_t Offset;
+		uint32_t Size;
+		ParameterKind Kind;
+		uint32_t Reserved;
+	};
+
+	struct EnumRecord
+	{
+		uint32_t Name;
+		uint32_t FullName;
+		uint32_t Package;
+		uint32_t FirstValue;
+		uint32_t ValueCount;
+		uint32_t Reserved;
+	};
+
+	struct EnumValueRecord
+	{
+		uint32_t Name;
+		uint32_t Value;
+	};
+
+	static_assert(sizeof(Section) == 16, "unexpected record size");
+	static_assert(sizeof(ObjectRecord) == 24, "unexpected record size");
+	static_assert(sizeof(StructRecord) == 56, "unexpected record size");
+	static_assert(sizeof(MemberRecord) == 32, "unexpected record size");
+	static_assert(sizeof(FunctionRecord) == 40, "unexpected record size");
+	static_assert(sizeof(ParameterRecord) == 32, "unexpected record size");
+	static_assert(sizeof(EnumRecord) == 24, "unexpected record size");
+	static_assert(sizeof(EnumValueRecord) == 8, "unexpected record size");
+}
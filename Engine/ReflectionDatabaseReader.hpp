@@ -0,0 +1,228 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+#include "ReflectionDatabase.hpp"
+
+/// <summary>
+/// Reads a binary reflection database (see ReflectionDatabase.hpp) from memory, for example a memory mapped view of the file.
+/// The reader does not copy or parse the data, all methods return pointers into the memory block.
+/// This header has no dependencies on the generator and can be used by external tools.
+/// </summary>
+class ReflectionDatabaseReader
+{
+public:
+	ReflectionDatabaseReader()
+		: data(nullptr),
+		  size(0)
+	{
+	}
+
+	/// <summary>
+	/// Opens a database which is loaded or mapped to memory. The memory must stay valid while the reader is used.
+	/// </summary>
+	/// <param name="_data">The database.</param>
+	/// <param name="_size">The size of the database in bytes.</param>
+	/// <returns>true if the database is valid, false if not.</returns>
+	bool Open(const void* _data, size_t _size)
+	{
+		using namespace ReflectionDatabase;
+
+		data = static_cast<const char*>(_data);
+		size = _size;
+
+		if (data == nullptr || size < sizeof(Header))
+		{
+			return Close();
+		}
+
+		auto header = GetHeader();
+		if (std::memcmp(header->Magic, Magic, sizeof(Magic)) != 0 || header->Version != Version)
+		{
+			return Close();
+		}
+
+		//every section must have the record size of this version and fit into the data
+		const uint32_t recordSizes[] = {
+			1,
+			sizeof(ObjectRecord),
+			sizeof(StructRecord),
+			sizeof(MemberRecord),
+			sizeof(FunctionRecord),
+			sizeof(ParameterRecord),
+			sizeof(EnumRecord),
+			sizeof(EnumValueRecord),
+			sizeof(uint32_t)
+		};
+		static_assert(sizeof(recordSizes) / sizeof(recordSizes[0]) == static_cast<size_t>(SectionType::Count), "missing section");
+
+		for (auto i = 0u; i < static_cast<size_t>(SectionType::Count); ++i)
+		{
+			auto& section = header->Sections[i];
+			if (section.RecordSize != recordSizes[i] || section.Offset > size || static_cast<uint64_t>(section.Count) * section.RecordSize > size - section.Offset)
+			{
+				return Close();
+			}
+		}
+
+		//the string section must end with a null terminator
+		auto& strings = GetSection(SectionType::Strings);
+		if (strings.Count == 0 || data[strings.Offset + strings.Count - 1] != '\0')
+		{
+			return Close();
+		}
+
+		return true;
+	}
+
+	bool IsOpen() const
+	{
+		return data != nullptr;
+	}
+
+	const ReflectionDatabase::Header* GetHeader() const
+	{
+		return reinterpret_cast<const ReflectionDatabase::Header*>(data);
+	}
+
+	/// <summary>
+	/// Gets a string by its offset.
+	/// </summary>
+	/// <param name="offset">The offset of the string.</param>
+	/// <returns>The string or nullptr if the offset is invalid.</returns>
+	const char* GetString(uint32_t offset) const
+	{
+		auto& section = GetSection(ReflectionDatabase::SectionType::Strings);
+		if (offset >= section.Count)
+		{
+			return nullptr;
+		}
+		return data + section.Offset + offset;
+	}
+
+	size_t GetObjectCount() const { return GetSection(ReflectionDatabase::SectionType::Objects).Count; }
+	size_t GetStructCount() const { return GetSection(ReflectionDatabase::SectionType::Structs).Count; }
+	size_t GetEnumCount() const { return GetSection(ReflectionDatabase::SectionType::Enums).Count; }
+
+	const ReflectionDatabase::ObjectRecord* GetObjectRecord(uint32_t index) const { return GetRecord<ReflectionDatabase::ObjectRecord>(ReflectionDatabase::SectionType::Objects, index); }
+	const ReflectionDatabase::StructRecord* GetStructRecord(uint32_t index) const { return GetRecord<ReflectionDatabase::StructRecord>(ReflectionDatabase::SectionType::Structs, index); }
+	const ReflectionDatabase::MemberRecord* GetMemberRecord(uint32_t index) const { return GetRecord<ReflectionDatabase::MemberRecord>(ReflectionDatabase::SectionType::Members, index); }
+	const ReflectionDatabase::FunctionRecord* GetFunctionRecord(uint32_t index) const { return GetRecord<ReflectionDatabase::FunctionRecord>(ReflectionDatabase::SectionType::Functions, index); }
+	const ReflectionDatabase::ParameterRecord* GetParameterRecord(uint32_t index) const { return GetRecord<ReflectionDatabase::ParameterRecord>(ReflectionDatabase::SectionType::Parameters, index); }
+	const ReflectionDatabase::EnumRecord* GetEnumRecord(uint32_t index) const { return GetRecord<ReflectionDatabase::EnumRecord>(ReflectionDatabase::SectionType::Enums, index); }
+	const ReflectionDatabase::EnumValueRecord* GetEnumValueRecord(uint32_t index) const { return GetRecord<ReflectionDatabase::EnumValueRecord>(ReflectionDatabase::SectionType::EnumValues, index); }
+
+	/// <summary>
+	/// Searches a struct or class by its full name (Example: "Class Engine.Actor") with a binary search over the name index.
+	/// </summary>
+	/// <param name="fullName">The full name.</param>
+	/// <returns>The struct or nullptr if it was not found.</returns>
+	const ReflectionDatabase::StructRecord* FindStruct(const char* fullName) const
+	{
+		using namespace ReflectionDatabase;
+
+		auto& section = GetSection(SectionType::StructsByName);
+		auto begin = reinterpret_cast<const uint32_t*>(data + section.Offset);
+		auto end = begin + section.Count;
+
+		auto it = std::lower_bound(begin, end, fullName, [this](uint32_t index, const char* name)
+		{
+			auto s = GetStructRecord(index);
+			return s != nullptr && Compare(s->FullName, name) < 0;
+		});
+		if (it == end)
+		{
+			return nullptr;
+		}
+
+		auto s = GetStructRecord(*it);
+		if (s == nullptr || Compare(s->FullName, fullName) != 0)
+		{
+			return nullptr;
+		}
+		return s;
+	}
+
+	/// <summary>
+	/// Searches a member of a struct by its name. The base structs are not searched.
+	/// </summary>
+	/// <param name="s">The struct.</param>
+	/// <param name="name">The name of the member.</param>
+	/// <returns>The member or nullptr if it was not found.</returns>
+	const ReflectionDatabase::MemberRecord* FindMember(const ReflectionDatabase::StructRecord& s, const char* name) const
+	{
+		for (auto i = 0u; i < s.MemberCount; ++i)
+		{
+			auto member = GetMemberRecord(s.FirstMember + i);
+			if (member != nullptr && Compare(member->Name, name) == 0)
+			{
+				return member;
+			}
+		}
+		return nullptr;
+	}
+
+	/// <summary>
+	/// Searches a function of a class by its name. The base classes are not searched.
+	/// </summary>
+	/// <param name="s">The class.</param>
+	/// <param name="name">The name of the function.</param>
+	/// <returns>The function or nullptr if it was not found.</returns>
+	const ReflectionDatabase::FunctionRecord* FindFunction(const ReflectionDatabase::StructRecord& s, const char* name) const
+	{
+		for (auto i = 0u; i < s.FunctionCount; ++i)
+		{
+			auto function = GetFunctionRecord(s.FirstFunction + i);
+			if (function != nullptr && Compare(function->Name, name) == 0)
+			{
+				return function;
+			}
+		}
+		return nullptr;
+	}
+
+private:
+	bool Close()
+	{
+		data = nullptr;
+		size = 0;
+		return false;
+	}
+
+	const ReflectionDatabase::Section& GetSection(ReflectionDatabase::SectionType type) const
+	{
+		return GetHeader()->Sections[static_cast<size_t>(type)];
+	}
+
+	/// <summary>
+	/// Compares a string of the database with a name like strcmp. An invalid string offset never matches and is ordered after every name.
+	/// </summary>
+	/// <param name="offset">The offset of the string.</param>
+	/// <param name="name">The name.</param>
+	/// <returns>The strcmp result.</returns>
+	int Compare(uint32_t offset, const char* name) const
+	{
+		auto str = GetString(offset);
+		if (str == nullptr)
+		{
+			return 1;
+		}
+		return std::strcmp(str, name);
+	}
+
+	template<typename T>
+	const T* GetRecord(ReflectionDatabase::SectionType type, uint32_t index) const
+	{
+		auto& section = GetSection(type);
+		if (index >= section.Count || section.RecordSize != sizeof(T))
+		{
+			return nullptr;
+		}
+		return reinterpret_cast<const T*>(data + section.Offset) + index;
+	}
+
+	const char* data;
+	size_t size;
+};
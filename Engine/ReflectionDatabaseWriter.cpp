@@ -0,0 +1,243 @@
+#include "ReflectionDatabaseWriter.hpp"
+
+#include <fstream>
+#include <cstring>
+#include <algorithm>
+
+#include "IGenerator.hpp"
+#include "ObjectsStore.hpp"
+
+using namespace ReflectionDatabase;
+
+ReflectionDatabaseWriter::ReflectionDatabaseWriter()
+{
+	//offset 0 is the empty string
+	AddString(std::string());
+}
+
+uint32_t ReflectionDatabaseWriter::AddString(const std::string& str)
+{
+	auto it = stringOffsets.find(str);
+	if (it != std::end(stringOffsets))
+	{
+		return it->second;
+	}
+
+	auto offset = static_cast<uint32_t>(strings.size());
+	strings.append(str.c_str(), str.length() + 1);
+
+	stringOffsets.emplace(str, offset);
+
+	return offset;
+}
+
+void ReflectionDatabaseWriter::AddObjects()
+{
+	ObjectsStore store;
+
+	objects.resize(store.GetObjectsNum());
+
+	for (auto i = 0u; i < objects.size(); ++i)
+	{
+		auto& record = objects[i];
+		record = {};
+		record.Name = InvalidIndex;
+		record.Class = InvalidIndex;
+		record.Outer = InvalidIndex;
+
+		auto obj = store.GetById(i);
+		if (!obj.IsValid())
+		{
+			continue;
+		}
+
+		record.Address = reinterpret_cast<uintptr_t>(obj.GetAddress());
+		record.Name = AddString(obj.GetName());
+
+		auto classObj = obj.GetClass();
+		if (classObj.IsValid())
+		{
+			record.Class = static_cast<uint32_t>(classObj.GetIndex());
+		}
+		auto outer = obj.GetOuter();
+		if (outer.IsValid())
+		{
+			record.Outer = static_cast<uint32_t>(outer.GetIndex());
+		}
+	}
+}
+
+void ReflectionDatabaseWriter::AddStruct(const UEStruct& structObj, const std::string& nameCpp, size_t size, size_t inheritedSize)
+{
+	StructRecord record = {};
+	record.Object = static_cast<uint32_t>(structObj.GetIndex());
+	record.Name = AddString(structObj.GetName());
+	record.FullName = AddString(structObj.GetFullName());
+	record.NameCpp = AddString(nameCpp);
+	record.Package = AddString(structObj.GetPackageObject().GetName());
+	record.Super = InvalidIndex;
+	record.Size = static_cast<uint32_t>(size);
+	record.InheritedSize = static_cast<uint32_t>(inheritedSize);
+	record.FirstMember = static_cast<uint32_t>(members.size());
+	record.FirstFunction = static_cast<uint32_t>(functions.size());
+	record.Flags = structObj.IsA<UEClass>() ? static_cast<uint32_t>(StructFlag_Class) : 0u;
+
+	structs.push_back(record);
+
+	auto super = structObj.GetSuper();
+	superObjects.push_back(super.IsValid() && super != structObj ? static_cast<uint32_t>(super.GetIndex()) : InvalidIndex);
+}
+
+void ReflectionDatabaseWriter::AddMember(const std::string& name, const std::string& type, size_t offset, size_t size, uint64_t flags, MemberKind kind, const std::string& comment)
+{
+	MemberRecord record = {};
+	record.PropertyFlags = flags;
+	record.Name = AddString(name);
+	record.Type = AddString(type);
+	record.Offset = static_cast<uint32_t>(offset);
+	record.Size = static_cast<uint32_t>(size);
+	record.Kind = kind;
+	record.Comment = AddString(comment);
+
+	members.push_back(record);
+
+	++structs.back().MemberCount;
+}
+
+void ReflectionDatabaseWriter::AddFunction(size_t index, const std::string& name, const std::string& fullName, uint64_t flags, size_t parmsSize)
+{
+	FunctionRecord record = {};
+	record.FunctionFlags = flags;
+	record.Object = static_cast<uint32_t>(index);
+	record.Name = AddString(name);
+	record.FullName = AddString(fullName);
+	record.Struct = static_cast<uint32_t>(structs.size() - 1);
+	record.ParmsSize = static_cast<uint32_t>(parmsSize);
+	record.FirstParameter = static_cast<uint32_t>(parameters.size());
+
+	functions.push_back(record);
+
+	++structs.back().FunctionCount;
+}
+
+void ReflectionDatabaseWriter::AddParameter(const std::string& name, const std::string& type, size_t offset, size_t size, uint64_t flags, ParameterKind kind)
+{
+	ParameterRecord record = {};
+	record.PropertyFlags = flags;
+	record.Name = AddString(name);
+	record.Type = AddString(type);
+	record.Offset = static_cast<uint32_t>(offset);
+	record.Size = static_cast<uint32_t>(size);
+	record.Kind = kind;
+
+	parameters.push_back(record);
+
+	++functions.back().ParameterCount;
+}
+
+void ReflectionDatabaseWriter::AddEnum(const std::string& name, const std::string& fullName, const std::string& package, const std::vector<std::string>& values)
+{
+	EnumRecord record = {};
+	record.Name = AddString(name);
+	record.FullName = AddString(fullName);
+	record.Package = AddString(package);
+	record.FirstValue = static_cast<uint32_t>(enumValues.size());
+	record.ValueCount = static_cast<uint32_t>(values.size());
+
+	enums.push_back(record);
+
+	for (auto i = 0u; i < values.size(); ++i)
+	{
+		enumValues.push_back({ AddString(values[i]), i });
+	}
+}
+
+bool ReflectionDatabaseWriter::Save(const fs::path& file)
+{
+	extern IGenerator* generator;
+
+	std::unordered_map<uint32_t, uint32_t> structIndices;
+	for (auto i = 0u; i < structs.size(); ++i)
+	{
+		structIndices[structs[i].Object] = i;
+	}
+	for (auto i = 0u; i < structs.size(); ++i)
+	{
+		auto it = structIndices.find(superObjects[i]);
+		if (it != std::end(structIndices))
+		{
+			structs[i].Super = it->second;
+		}
+	}
+
+	std::vector<uint32_t> structsByName(structs.size());
+	for (auto i = 0u; i < structsByName.size(); ++i)
+	{
+		structsByName[i] = i;
+	}
+	std::sort(std::begin(structsByName), std::end(structsByName), [this](uint32_t lhs, uint32_t rhs)
+	{
+		return std::strcmp(strings.data() + structs[lhs].FullName, strings.data() + structs[rhs].FullName) < 0;
+	});
+
+	Header header = {};
+	std::memcpy(header.Magic, Magic, sizeof(Magic));
+	header.Version = Version;
+	header.PointerSize = sizeof(void*);
+	header.GameName = AddString(generator->GetGameName());
+	header.GameVersion = AddString(generator->GetGameVersion());
+
+	struct SectionData
+	{
+		const void* Data;
+		size_t Count;
+		size_t RecordSize;
+	};
+
+	SectionData sections[] = {
+		{ strings.data(), strings.size(), 1 },
+		{ objects.data(), objects.size(), sizeof(ObjectRecord) },
+		{ structs.data(), structs.size(), sizeof(StructRecord) },
+		{ members.data(), members.size(), sizeof(MemberRecord) },
+		{ functions.data(), functions.size(), sizeof(FunctionRecord) },
+		{ parameters.data(), parameters.size(), sizeof(ParameterRecord) },
+		{ enums.data(), enums.size(), sizeof(EnumRecord) },
+		{ enumValues.data(), enumValues.size(), sizeof(EnumValueRecord) },
+		{ structsByName.data(), structsByName.size(), sizeof(uint32_t) }
+	};
+	static_assert(sizeof(sections) / sizeof(sections[0]) == static_cast<size_t>(SectionType::Count), "missing section");
+
+	//every section starts 8 byte aligned
+	auto align = [](uint64_t offset) { return (offset + 7) & ~static_cast<uint64_t>(7); };
+
+	uint64_t offset = align(sizeof(Header));
+	for (auto i = 0u; i < static_cast<size_t>(SectionType::Count); ++i)
+	{
+		header.Sections[i].Offset = offset;
+		header.Sections[i].Count = static_cast<uint32_t>(sections[i].Count);
+		header.Sections[i].RecordSize = static_cast<uint32_t>(sections[i].RecordSize);
+
+		offset = align(offset + sections[i].Count * sections[i].RecordSize);
+	}
+
+	std::ofstream os(file, std::ios::binary);
+	if (!os)
+	{
+		return false;
+	}
+
+	const char padding[8] = {};
+
+	os.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+	os.write(padding, static_cast<std::streamsize>(header.Sections[0].Offset - sizeof(Header)));
+
+	for (auto i = 0u; i < static_cast<size_t>(SectionType::Count); ++i)
+	{
+		auto size = sections[i].Count * sections[i].RecordSize;
+
+		os.write(static_cast<const char*>(sections[i].Data), static_cast<std::streamsize>(size));
+		os.write(padding, static_cast<std::streamsize>(align(size) - size));
+	}
+
+	return static_cast<bool>(os);
+}
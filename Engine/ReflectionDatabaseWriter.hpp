@@ -0,0 +1,107 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <filesystem>
+namespace fs = std::experimental::filesystem;
+
+#include "GenericTypes.hpp"
+#include "ReflectionDatabase.hpp"
+
+/// <summary>
+/// Collects the reflection data of all packages and saves it as binary reflection database (see ReflectionDatabase.hpp).
+/// Members and functions are added to the last added struct, parameters to the last added function.
+/// </summary>
+class ReflectionDatabaseWriter
+{
+public:
+	ReflectionDatabaseWriter();
+
+	/// <summary>
+	/// Adds all objects of the object store.
+	/// </summary>
+	void AddObjects();
+
+	/// <summary>
+	/// Adds a struct or class.
+	/// </summary>
+	/// <param name="structObj">The struct or class object.</param>
+	/// <param name="nameCpp">The C++ name of the struct.</param>
+	/// <param name="size">The size of the struct.</param>
+	/// <param name="inheritedSize">The size of the base struct.</param>
+	void AddStruct(const UEStruct& structObj, const std::string& nameCpp, size_t size, size_t inheritedSize);
+
+	/// <summary>
+	/// Adds a member to the last added struct.
+	/// </summary>
+	/// <param name="name">The name of the member.</param>
+	/// <param name="type">The C++ type of the member.</param>
+	/// <param name="offset">The offset of the member.</param>
+	/// <param name="size">The size of the member.</param>
+	/// <param name="flags">The property flags.</param>
+	/// <param name="kind">The kind of the member.</param>
+	/// <param name="comment">The comment of the member.</param>
+	void AddMember(const std::string& name, const std::string& type, size_t offset, size_t size, uint64_t flags, ReflectionDatabase::MemberKind kind, const std::string& comment);
+
+	/// <summary>
+	/// Adds a function to the last added struct.
+	/// </summary>
+	/// <param name="index">The object index of the function.</param>
+	/// <param name="name">The name of the function.</param>
+	/// <param name="fullName">The full name of the function.</param>
+	/// <param name="flags">The function flags.</param>
+	/// <param name="parmsSize">The size of the parameter struct.</param>
+	void AddFunction(size_t index, const std::string& name, const std::string& fullName, uint64_t flags, size_t parmsSize);
+
+	/// <summary>
+	/// Adds a parameter to the last added function.
+	/// </summary>
+	/// <param name="name">The name of the parameter.</param>
+	/// <param name="type">The C++ type of the parameter.</param>
+	/// <param name="offset">The offset of the parameter in the parameter struct.</param>
+	/// <param name="size">The size of the parameter.</param>
+	/// <param name="flags">The property flags.</param>
+	/// <param name="kind">The kind of the parameter.</param>
+	void AddParameter(const std::string& name, const std::string& type, size_t offset, size_t size, uint64_t flags, ReflectionDatabase::ParameterKind kind);
+
+	/// <summary>
+	/// Adds an enum.
+	/// </summary>
+	/// <param name="name">The name of the enum.</param>
+	/// <param name="fullName">The full name of the enum.</param>
+	/// <param name="package">The name of the package.</param>
+	/// <param name="values">The names of the values.</param>
+	void AddEnum(const std::string& name, const std::string& fullName, const std::string& package, const std::vector<std::string>& values);
+
+	/// <summary>
+	/// Resolves the struct references and saves the database.
+	/// </summary>
+	/// <param name="file">The file to create.</param>
+	/// <returns>true if it succeeds, false if it fails.</returns>
+	bool Save(const fs::path& file);
+
+private:
+	/// <summary>
+	/// Adds a string to the string section. Every string is stored only once.
+	/// </summary>
+	/// <param name="str">The string.</param>
+	/// <returns>The offset of the string.</returns>
+	uint32_t AddString(const std::string& str);
+
+	std::string strings;
+	std::unordered_map<std::string, uint32_t> stringOffsets;
+
+	std::vector<ReflectionDatabase::ObjectRecord> objects;
+	std::vector<ReflectionDatabase::StructRecord> structs;
+	std::vector<ReflectionDatabase::MemberRecord> members;
+	std::vector<ReflectionDatabase::FunctionRecord> functions;
+	std::vector<ReflectionDatabase::ParameterRecord> parameters;
+	std::vector<ReflectionDatabase::EnumRecord> enums;
+	std::vector<ReflectionDatabase::EnumValueRecord> enumValues;
+
+	/// <summary>
+	/// The object index of the base struct of every struct. It gets resolved to the struct index on save.
+	/// </summary>
+	std::vector<uint32_t> superObjects;
+};
@@ -0,0 +1,613 @@
+#include "ReflectionDiff.hpp"
+
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "tinyformat.h"
+#include "JsonWriter.hpp"
+
+using namespace ReflectionDatabase;
+
+namespace
+{
+	/// <summary>
+	/// FNV-1a hash of a null terminated string.
+	/// </summary>
+	struct StringHash
+	{
+		size_t operator()(const char* str) const
+		{
+			uint64_t hash = 14695981039346656037ull;
+			for (; *str != '\0'; ++str)
+			{
+				hash ^= static_cast<unsigned char>(*str);
+				hash *= 1099511628211ull;
+			}
+			return static_cast<size_t>(hash);
+		}
+	};
+
+	struct StringEqual
+	{
+		bool operator()(const char* lhs, const char* rhs) const
+		{
+			return std::strcmp(lhs, rhs) == 0;
+		}
+	};
+
+	/// <summary>
+	/// Maps the strings of a database to records without copying the strings.
+	/// </summary>
+	template<typename T>
+	using StringMap = std::unordered_map<const char*, T, StringHash, StringEqual>;
+
+	using StringSet = std::unordered_set<const char*, StringHash, StringEqual>;
+
+	const char* GetString(const ReflectionDatabaseReader& database, uint32_t offset)
+	{
+		auto str = database.GetString(offset);
+		return str != nullptr ? str : "";
+	}
+
+	std::string GetSuperName(const ReflectionDatabaseReader& database, const StructRecord& s)
+	{
+		auto super = database.GetStructRecord(s.Super);
+		return super != nullptr ? GetString(database, super->FullName) : "";
+	}
+
+	/// <summary>
+	/// Formats the signature of a function (Example: "bool(int32_t Value, class UObject** Target)").
+	/// </summary>
+	std::string FormatSignature(const ReflectionDatabaseReader& database, const FunctionRecord& function)
+	{
+		std::string returnType = "void";
+		std::string parameters;
+
+		for (auto i = 0u; i < function.ParameterCount; ++i)
+		{
+			auto parameter = database.GetParameterRecord(function.FirstParameter + i);
+			if (parameter == nullptr)
+			{
+				continue;
+			}
+
+			if (parameter->Kind == ParameterKind::Return)
+			{
+				returnType = GetString(database, parameter->Type);
+				continue;
+			}
+
+			if (!parameters.empty())
+			{
+				parameters += ", ";
+			}
+			parameters += GetString(database, parameter->Type);
+			if (parameter->Kind == ParameterKind::Out)
+			{
+				parameters += '*';
+			}
+			parameters += ' ';
+			parameters += GetString(database, parameter->Name);
+		}
+
+		return returnType + "(" + parameters + ")";
+	}
+
+	std::string FormatEnumValues(const ReflectionDatabaseReader& database, const EnumRecord& e)
+	{
+		std::string values;
+		for (auto i = 0u; i < e.ValueCount; ++i)
+		{
+			auto value = database.GetEnumValueRecord(e.FirstValue + i);
+			if (value == nullptr)
+			{
+				continue;
+			}
+
+			if (!values.empty())
+			{
+				values += ", ";
+			}
+			values += tfm::format("%s = %d", GetString(database, value->Name), value->Value);
+		}
+		return values;
+	}
+
+	/// <summary>
+	/// Calls the callback for every function. The functions are stored grouped by struct, so the structs are walked to visit all of them.
+	/// </summary>
+	template<typename Callback>
+	void ForEachFunction(const ReflectionDatabaseReader& database, Callback callback)
+	{
+		for (auto i = 0u; i < database.GetStructCount(); ++i)
+		{
+			auto s = database.GetStructRecord(i);
+			if (s == nullptr)
+			{
+				continue;
+			}
+
+			for (auto j = 0u; j < s->FunctionCount; ++j)
+			{
+				auto function = database.GetFunctionRecord(s->FirstFunction + j);
+				if (function != nullptr)
+				{
+					callback(*function);
+				}
+			}
+		}
+	}
+
+	bool IsAdded(ReflectionDiff::ChangeType type)
+	{
+		using ChangeType = ReflectionDiff::ChangeType;
+
+		return type == ChangeType::StructAdded || type == ChangeType::MemberAdded || type == ChangeType::FunctionAdded || type == ChangeType::EnumAdded;
+	}
+
+	bool IsRemoved(ReflectionDiff::ChangeType type)
+	{
+		using ChangeType = ReflectionDiff::ChangeType;
+
+		return type == ChangeType::StructRemoved || type == ChangeType::MemberRemoved || type == ChangeType::FunctionRemoved || type == ChangeType::EnumRemoved;
+	}
+
+	/// <summary>
+	/// Checks if the change type uses the values, the texts or both.
+	/// </summary>
+	void GetUsedFields(ReflectionDiff::ChangeType type, bool& values, bool& texts)
+	{
+		using ChangeType = ReflectionDiff::ChangeType;
+
+		switch (type)
+		{
+			case ChangeType::StructSuperChanged:
+			case ChangeType::MemberTypeChanged:
+			case ChangeType::FunctionAdded:
+			case ChangeType::FunctionRemoved:
+			case ChangeType::EnumValuesChanged:
+				values = false;
+				texts = true;
+				break;
+			case ChangeType::MemberAdded:
+			case ChangeType::MemberRemoved:
+			case ChangeType::FunctionSignatureChanged:
+				values = true;
+				texts = true;
+				break;
+			default:
+				values = true;
+				texts = false;
+				break;
+		}
+	}
+}
+
+const char* ReflectionDiff::GetChangeTypeName(ChangeType type)
+{
+	switch (type)
+	{
+		case ChangeType::StructAdded: return "StructAdded";
+		case ChangeType::StructRemoved: return "StructRemoved";
+		case ChangeType::StructSizeChanged: return "StructSizeChanged";
+		case ChangeType::StructSuperChanged: return "StructSuperChanged";
+		case ChangeType::MemberAdded: return "MemberAdded";
+		case ChangeType::MemberRemoved: return "MemberRemoved";
+		case ChangeType::MemberOffsetChanged: return "MemberOffsetChanged";
+		case ChangeType::MemberSizeChanged: return "MemberSizeChanged";
+		case ChangeType::MemberTypeChanged: return "MemberTypeChanged";
+		case ChangeType::MemberFlagsChanged: return "MemberFlagsChanged";
+		case ChangeType::FunctionAdded: return "FunctionAdded";
+		case ChangeType::FunctionRemoved: return "FunctionRemoved";
+		case ChangeType::FunctionFlagsChanged: return "FunctionFlagsChanged";
+		case ChangeType::FunctionSignatureChanged: return "FunctionSignatureChanged";
+		case ChangeType::EnumAdded: return "EnumAdded";
+		case ChangeType::EnumRemoved: return "EnumRemoved";
+		case ChangeType::EnumValuesChanged: return "EnumValuesChanged";
+	}
+	return "Unknown";
+}
+
+void ReflectionDiff::Compare(const ReflectionDatabaseReader& oldDatabase, const ReflectionDatabaseReader& newDatabase)
+{
+	changes.clear();
+
+	oldGame = tfm::format("%s %s", GetString(oldDatabase, oldDatabase.GetHeader()->GameName), GetString(oldDatabase, oldDatabase.GetHeader()->GameVersion));
+	newGame = tfm::format("%s %s", GetString(newDatabase, newDatabase.GetHeader()->GameName), GetString(newDatabase, newDatabase.GetHeader()->GameVersion));
+
+	CompareStructs(oldDatabase, newDatabase);
+	CompareFunctions(oldDatabase, newDatabase);
+	CompareEnums(oldDatabase, newDatabase);
+}
+
+void ReflectionDiff::Add(ChangeType type, const std::string& owner, const std::string& name, uint64_t oldValue, uint64_t newValue, const std::string& oldText, const std::string& newText)
+{
+	changes.push_back({ type, owner, name, oldValue, newValue, oldText, newText });
+}
+
+void ReflectionDiff::CompareStructs(const ReflectionDatabaseReader& oldDatabase, const ReflectionDatabaseReader& newDatabase)
+{
+	//build side: the old structs, probe side: the new structs
+	StringMap<const StructRecord*> oldStructs(oldDatabase.GetStructCount());
+	for (auto i = 0u; i < oldDatabase.GetStructCount(); ++i)
+	{
+		auto s = oldDatabase.GetStructRecord(i);
+		if (s == nullptr)
+		{
+			continue;
+		}
+
+		oldStructs.emplace(GetString(oldDatabase, s->FullName), s);
+	}
+
+	StringSet matched(newDatabase.GetStructCount());
+
+	for (auto i = 0u; i < newDatabase.GetStructCount(); ++i)
+	{
+		auto newStruct = newDatabase.GetStructRecord(i);
+		if (newStruct == nullptr)
+		{
+			continue;
+		}
+
+		auto fullName = GetString(newDatabase, newStruct->FullName);
+
+		auto it = oldStructs.find(fullName);
+		if (it == std::end(oldStructs))
+		{
+			Add(ChangeType::StructAdded, fullName, std::string(), 0, newStruct->Size, std::string(), std::string());
+			continue;
+		}
+
+		auto oldStruct = it->second;
+		matched.insert(it->first);
+
+		if (oldStruct->Size != newStruct->Size)
+		{
+			Add(ChangeType::StructSizeChanged, fullName, std::string(), oldStruct->Size, newStruct->Size, std::string(), std::string());
+		}
+
+		auto oldSuper = GetSuperName(oldDatabase, *oldStruct);
+		auto newSuper = GetSuperName(newDatabase, *newStruct);
+		if (oldSuper != newSuper)
+		{
+			Add(ChangeType::StructSuperChanged, fullName, std::string(), 0, 0, oldSuper, newSuper);
+		}
+
+		CompareMembers(oldDatabase, *oldStruct, newDatabase, *newStruct, fullName);
+	}
+
+	for (auto i = 0u; i < oldDatabase.GetStructCount(); ++i)
+	{
+		auto oldStruct = oldDatabase.GetStructRecord(i);
+		if (oldStruct == nullptr)
+		{
+			continue;
+		}
+
+		auto fullName = GetString(oldDatabase, oldStruct->FullName);
+		if (matched.find(fullName) == std::end(matched))
+		{
+			Add(ChangeType::StructRemoved, fullName, std::string(), oldStruct->Size, 0, std::string(), std::string());
+		}
+	}
+}
+
+void ReflectionDiff::CompareMembers(const ReflectionDatabaseReader& oldDatabase, const StructRecord& oldStruct, const ReflectionDatabaseReader& newDatabase, const StructRecord& newStruct, const std::string& owner)
+{
+	//padding members are generated and only real properties have stable names
+	StringMap<const MemberRecord*> oldMembers(oldStruct.MemberCount);
+	for (auto i = 0u; i < oldStruct.MemberCount; ++i)
+	{
+		auto member = oldDatabase.GetMemberRecord(oldStruct.FirstMember + i);
+		if (member != nullptr && member->Kind == MemberKind::Property)
+		{
+			oldMembers.emplace(GetString(oldDatabase, member->Name), member);
+		}
+	}
+
+	for (auto i = 0u; i < newStruct.MemberCount; ++i)
+	{
+		auto newMember = newDatabase.GetMemberRecord(newStruct.FirstMember + i);
+		if (newMember == nullptr || newMember->Kind != MemberKind::Property)
+		{
+			continue;
+		}
+
+		auto name = GetString(newDatabase, newMember->Name);
+		auto newType = GetString(newDatabase, newMember->Type);
+
+		auto it = oldMembers.find(name);
+		if (it == std::end(oldMembers))
+		{
+			Add(ChangeType::MemberAdded, owner, name, 0, newMember->Offset, std::string(), newType);
+			continue;
+		}
+
+		auto oldMember = it->second;
+		oldMembers.erase(it);
+
+		if (oldMember->Offset != newMember->Offset)
+		{
+			Add(ChangeType::MemberOffsetChanged, owner, name, oldMember->Offset, newMember->Offset, std::string(), std::string());
+		}
+		if (oldMember->Size != newMember->Size)
+		{
+			Add(ChangeType::MemberSizeChanged, owner, name, oldMember->Size, newMember->Size, std::string(), std::string());
+		}
+		auto oldType = GetString(oldDatabase, oldMember->Type);
+		if (std::strcmp(oldType, newType) != 0)
+		{
+			Add(ChangeType::MemberTypeChanged, owner, name, 0, 0, oldType, newType);
+		}
+		if (oldMember->PropertyFlags != newMember->PropertyFlags)
+		{
+			Add(ChangeType::MemberFlagsChanged, owner, name, oldMember->PropertyFlags, newMember->PropertyFlags, std::string(), std::string());
+		}
+	}
+
+	//the remaining members were removed, report them in the old order
+	for (auto i = 0u; i < oldStruct.MemberCount && !oldMembers.empty(); ++i)
+	{
+		auto oldMember = oldDatabase.GetMemberRecord(oldStruct.FirstMember + i);
+		if (oldMember == nullptr)
+		{
+			continue;
+		}
+
+		auto it = oldMembers.find(GetString(oldDatabase, oldMember->Name));
+		if (it != std::end(oldMembers) && it->second == oldMember)
+		{
+			Add(ChangeType::MemberRemoved, owner, it->first, oldMember->Offset, 0, GetString(oldDatabase, oldMember->Type), std::string());
+		}
+	}
+}
+
+void ReflectionDiff::CompareFunctions(const ReflectionDatabaseReader& oldDatabase, const ReflectionDatabaseReader& newDatabase)
+{
+	StringMap<const FunctionRecord*> oldFunctions;
+	ForEachFunction(oldDatabase, [&](const FunctionRecord& function)
+	{
+		oldFunctions.emplace(GetString(oldDatabase, function.FullName), &function);
+	});
+
+	StringSet matched;
+
+	ForEachFunction(newDatabase, [&](const FunctionRecord& newFunction)
+	{
+		auto fullName = GetString(newDatabase, newFunction.FullName);
+		auto newSignature = FormatSignature(newDatabase, newFunction);
+
+		auto it = oldFunctions.find(fullName);
+		if (it == std::end(oldFunctions))
+		{
+			Add(ChangeType::FunctionAdded, fullName, std::string(), 0, 0, std::string(), newSignature);
+			return;
+		}
+
+		auto& oldFunction = *it->second;
+		matched.insert(it->first);
+
+		if (oldFunction.FunctionFlags != newFunction.FunctionFlags)
+		{
+			Add(ChangeType::FunctionFlagsChanged, fullName, std::string(), oldFunction.FunctionFlags, newFunction.FunctionFlags, std::string(), std::string());
+		}
+
+		//the size of the parameter struct changes if a parameter changes its type or size
+		auto oldSignature = FormatSignature(oldDatabase, oldFunction);
+		if (oldSignature != newSignature || oldFunction.ParmsSize != newFunction.ParmsSize)
+		{
+			Add(ChangeType::FunctionSignatureChanged, fullName, std::string(), oldFunction.ParmsSize, newFunction.ParmsSize, oldSignature, newSignature);
+		}
+	});
+
+	ForEachFunction(oldDatabase, [&](const FunctionRecord& oldFunction)
+	{
+		auto fullName = GetString(oldDatabase, oldFunction.FullName);
+		if (matched.find(fullName) == std::end(matched))
+		{
+			Add(ChangeType::FunctionRemoved, fullName, std::string(), 0, 0, FormatSignature(oldDatabase, oldFunction), std::string());
+		}
+	});
+}
+
+void ReflectionDiff::CompareEnums(const ReflectionDatabaseReader& oldDatabase, const ReflectionDatabaseReader& newDatabase)
+{
+	StringMap<const EnumRecord*> oldEnums(oldDatabase.GetEnumCount());
+	for (auto i = 0u; i < oldDatabase.GetEnumCount(); ++i)
+	{
+		auto e = oldDatabase.GetEnumRecord(i);
+		if (e == nullptr)
+		{
+			continue;
+		}
+
+		oldEnums.emplace(GetString(oldDatabase, e->FullName), e);
+	}
+
+	StringSet matched(newDatabase.GetEnumCount());
+
+	for (auto i = 0u; i < newDatabase.GetEnumCount(); ++i)
+	{
+		auto newEnum = newDatabase.GetEnumRecord(i);
+		if (newEnum == nullptr)
+		{
+			continue;
+		}
+
+		auto fullName = GetString(newDatabase, newEnum->FullName);
+
+		auto it = oldEnums.find(fullName);
+		if (it == std::end(oldEnums))
+		{
+			Add(ChangeType::EnumAdded, fullName, std::string(), 0, newEnum->ValueCount, std::string(), std::string());
+			continue;
+		}
+
+		matched.insert(it->first);
+
+		auto oldValues = FormatEnumValues(oldDatabase, *it->second);
+		auto newValues = FormatEnumValues(newDatabase, *newEnum);
+		if (oldValues != newValues)
+		{
+			Add(ChangeType::EnumValuesChanged, fullName, std::string(), 0, 0, oldValues, newValues);
+		}
+	}
+
+	for (auto i = 0u; i < oldDatabase.GetEnumCount(); ++i)
+	{
+		auto oldEnum = oldDatabase.GetEnumRecord(i);
+		if (oldEnum == nullptr)
+		{
+			continue;
+		}
+
+		auto fullName = GetString(oldDatabase, oldEnum->FullName);
+		if (matched.find(fullName) == std::end(matched))
+		{
+			Add(ChangeType::EnumRemoved, fullName, std::string(), oldEnum->ValueCount, 0, std::string(), std::string());
+		}
+	}
+}
+
+void ReflectionDiff::WriteReport(std::ostream& os) const
+{
+	size_t counts[static_cast<size_t>(ChangeType::EnumValuesChanged) + 1] = {};
+	for (auto&& change : changes)
+	{
+		++counts[static_cast<size_t>(change.Type)];
+	}
+
+	tfm::format(os, "Reflection diff: %s -> %s\n", oldGame, newGame);
+	tfm::format(os, "%d changes\n", changes.size());
+	for (auto i = 0u; i < sizeof(counts) / sizeof(counts[0]); ++i)
+	{
+		if (counts[i] != 0)
+		{
+			tfm::format(os, "\t%-26s %d\n", GetChangeTypeName(static_cast<ChangeType>(i)), counts[i]);
+		}
+	}
+
+	const std::string* owner = nullptr;
+	for (auto&& change : changes)
+	{
+		if (owner == nullptr || *owner != change.Owner)
+		{
+			owner = &change.Owner;
+			tfm::format(os, "\n%s\n", change.Owner);
+		}
+
+		switch (change.Type)
+		{
+			case ChangeType::StructAdded:
+				tfm::format(os, "\t+ added (size 0x%X)\n", change.NewValue);
+				break;
+			case ChangeType::StructRemoved:
+				tfm::format(os, "\t- removed (size 0x%X)\n", change.OldValue);
+				break;
+			case ChangeType::StructSizeChanged:
+				tfm::format(os, "\t~ size 0x%X -> 0x%X\n", change.OldValue, change.NewValue);
+				break;
+			case ChangeType::StructSuperChanged:
+				tfm::format(os, "\t~ base %s -> %s\n", change.OldText, change.NewText);
+				break;
+			case ChangeType::MemberAdded:
+				tfm::format(os, "\t+ %s %s at 0x%04X\n", change.NewText, change.Name, change.NewValue);
+				break;
+			case ChangeType::MemberRemoved:
+				tfm::format(os, "\t- %s %s at 0x%04X\n", change.OldText, change.Name, change.OldValue);
+				break;
+			case ChangeType::MemberOffsetChanged:
+				tfm::format(os, "\t~ %s moved 0x%04X -> 0x%04X\n", change.Name, change.OldValue, change.NewValue);
+				break;
+			case ChangeType::MemberSizeChanged:
+				tfm::format(os, "\t~ %s size 0x%X -> 0x%X\n", change.Name, change.OldValue, change.NewValue);
+				break;
+			case ChangeType::MemberTypeChanged:
+				tfm::format(os, "\t~ %s type %s -> %s\n", change.Name, change.OldText, change.NewText);
+				break;
+			case ChangeType::MemberFlagsChanged:
+				tfm::format(os, "\t~ %s flags 0x%016X -> 0x%016X\n", change.Name, change.OldValue, change.NewValue);
+				break;
+			case ChangeType::FunctionAdded:
+				tfm::format(os, "\t+ added %s\n", change.NewText);
+				break;
+			case ChangeType::FunctionRemoved:
+				tfm::format(os, "\t- removed %s\n", change.OldText);
+				break;
+			case ChangeType::FunctionFlagsChanged:
+				tfm::format(os, "\t~ flags 0x%08X -> 0x%08X\n", change.OldValue, change.NewValue);
+				break;
+			case ChangeType::FunctionSignatureChanged:
+				tfm::format(os, "\t~ signature %s [0x%X] -> %s [0x%X]\n", change.OldText, change.OldValue, change.NewText, change.NewValue);
+				break;
+			case ChangeType::EnumAdded:
+				tfm::format(os, "\t+ added (%d values)\n", change.NewValue);
+				break;
+			case ChangeType::EnumRemoved:
+				tfm::format(os, "\t- removed (%d values)\n", change.OldValue);
+				break;
+			case ChangeType::EnumValuesChanged:
+				tfm::format(os, "\t~ values %s -> %s\n", change.OldText, change.NewText);
+				break;
+		}
+	}
+}
+
+void ReflectionDiff::WritePatchList(std::ostream& os) const
+{
+	JsonWriter writer(os);
+
+	writer.BeginObject();
+	writer.Key("Old");
+	writer.String(oldGame);
+	writer.Key("New");
+	writer.String(newGame);
+	writer.Key("Changes");
+	writer.BeginArray();
+	for (auto&& change : changes)
+	{
+		bool values;
+		bool texts;
+		GetUsedFields(change.Type, values, texts);
+
+		auto writeOld = !IsAdded(change.Type);
+		auto writeNew = !IsRemoved(change.Type);
+
+		writer.BeginObject();
+		writer.Key("Type");
+		writer.String(GetChangeTypeName(change.Type));
+		writer.Key("Owner");
+		writer.String(change.Owner);
+		if (!change.Name.empty())
+		{
+			writer.Key("Name");
+			writer.String(change.Name);
+		}
+		if (values && writeOld)
+		{
+			writer.Key("OldValue");
+			writer.Number(change.OldValue);
+		}
+		if (values && writeNew)
+		{
+			writer.Key("NewValue");
+			writer.Number(change.NewValue);
+		}
+		if (texts && writeOld)
+		{
+			writer.Key("OldText");
+			writer.String(change.OldText);
+		}
+		if (texts && writeNew)
+		{
+			writer.Key("NewText");
+			writer.String(change.NewText);
+		}
+		writer.EndObject();
+	}
+	writer.EndArray();
+	writer.EndObject();
+	os << '\n';
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <cstdint>
+
+#include "ReflectionDatabaseReader.hpp"
+
+/// <summary>
+/// Compares the reflection databases (see ReflectionDatabase.hpp) of two builds of a game.
+/// Structs, functions and enums are matched by their full name, members by their name. All matches are hash joins on the strings of the databases,
+/// so the comparison is linear in the number of records and nothing gets copied.
+/// </summary>
+class ReflectionDiff
+{
+public:
+	enum class ChangeType
+	{
+		StructAdded,
+		StructRemoved,
+		StructSizeChanged,
+		StructSuperChanged,
+		MemberAdded,
+		MemberRemoved,
+		MemberOffsetChanged,
+		MemberSizeChanged,
+		MemberTypeChanged,
+		MemberFlagsChanged,
+		FunctionAdded,
+		FunctionRemoved,
+		FunctionFlagsChanged,
+		FunctionSignatureChanged,
+		EnumAdded,
+		EnumRemoved,
+		EnumValuesChanged
+	};
+
+	/// <summary>
+	/// A single change. Depending on the type the values (sizes, offsets, flags) or the texts (types, signatures) are used.
+	/// Added entries only have new values, removed entries only old values.
+	/// </summary>
+	struct Change
+	{
+		ChangeType Type;
+		/// <summary>The full name of the struct, function or enum.</summary>
+		std::string Owner;
+		/// <summary>The name of the member. Empty if the owner itself changed.</summary>
+		std::string Name;
+		uint64_t OldValue;
+		uint64_t NewValue;
+		std::string OldText;
+		std::string NewText;
+	};
+
+	/// <summary>
+	/// Compares the databases. The changes are ordered like the records of the new database, removed entries follow in the order of the old database.
+	/// </summary>
+	/// <param name="oldDatabase">The database of the old build.</param>
+	/// <param name="newDatabase">The database of the new build.</param>
+	void Compare(const ReflectionDatabaseReader& oldDatabase, const ReflectionDatabaseReader& newDatabase);
+
+	const std::vector<Change>& GetChanges() const
+	{
+		return changes;
+	}
+
+	/// <summary>
+	/// Writes a report for humans with a summary and the changes grouped by owner.
+	/// </summary>
+	/// <param name="os">The stream to write to.</param>
+	void WriteReport(std::ostream& os) const;
+
+	/// <summary>
+	/// Writes the changes as JSON patch list for tools.
+	/// </summary>
+	/// <param name="os">The stream to write to.</param>
+	void WritePatchList(std::ostream& os) const;
+
+	static const char* GetChangeTypeName(ChangeType type);
+
+private:
+	void CompareStructs(const ReflectionDatabaseReader& oldDatabase, const ReflectionDatabaseReader& newDatabase);
+
+	void CompareMembers(const ReflectionDatabaseReader& oldDatabase, const ReflectionDatabase::StructRecord& oldStruct, const ReflectionDatabaseReader& newDatabase, const ReflectionDatabase::StructRecord& newStruct, const std::string& owner);
+
+	void CompareFunctions(const ReflectionDatabaseReader& oldDatabase, const ReflectionDatabaseReader& newDatabase);
+
+	void CompareEnums(const ReflectionDatabaseReader& oldDatabase, const ReflectionDatabaseReader& newDatabase);
+
+	void Add(ChangeType type, const std::string& owner, const std::string& name, uint64_t oldValue, uint64_t newValue, const std::string& oldText, const std::string& newText);
+
+	std::string oldGame;
+	std::string newGame;
+
+	std::vector<Change> changes;
+};
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+
+/// <summary>
+/// A lock-free ring buffer with a fixed capacity for multiple producers and multiple consumers.
+/// Every slot has a sequence number which tells the producers and consumers if the slot is free or filled.
+/// </summary>
+/// <typeparam name="T">Type of the items.</typeparam>
+template<typename T>
+class RingBuffer
+{
+public:
+	/// <summary>
+	/// Constructor.
+	/// </summary>
+	/// <param name="capacity">The capacity. It gets rounded up to a power of two.</param>
+	explicit RingBuffer(size_t capacity)
+		: mask(RoundUpToPowerOfTwo(capacity) - 1),
+		  slots(new Slot[mask + 1]),
+		  head(0),
+		  tail(0)
+	{
+		for (auto i = 0u; i <= mask; ++i)
+		{
+			slots[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	RingBuffer(const RingBuffer&) = delete;
+	RingBuffer& operator=(const RingBuffer&) = delete;
+
+	/// <summary>
+	/// Adds an item to the buffer.
+	/// </summary>
+	/// <param name="item">[in,out] The item. It is only moved if the push succeeds.</param>
+	/// <returns>false if the buffer is full, else true.</returns>
+	bool TryPush(T& item)
+	{
+		auto position = tail.load(std::memory_order_relaxed);
+		while (true)
+		{
+			auto& slot = slots[position & mask];
+			auto sequence = slot.Sequence.load(std::memory_order_acquire);
+			auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+			if (diff == 0)
+			{
+				if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					slot.Item = std::move(item);
+					slot.Sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				position = tail.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Removes the oldest item of the buffer.
+	/// </summary>
+	/// <param name="item">[out] The item.</param>
+	/// <returns>false if the buffer is empty, else true.</returns>
+	bool TryPop(T& item)
+	{
+		auto position = head.load(std::memory_order_relaxed);
+		while (true)
+		{
+			auto& slot = slots[position & mask];
+			auto sequence = slot.Sequence.load(std::memory_order_acquire);
+			auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+			if (diff == 0)
+			{
+				if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					item = std::move(slot.Item);
+					slot.Sequence.store(position + mask + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				position = head.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+private:
+	static size_t RoundUpToPowerOfTwo(size_t value)
+	{
+		size_t result = 2;
+		while (result < value)
+		{
+			result <<= 1;
+		}
+		return result;
+	}
+
+	struct Slot
+	{
+		std::atomic<size_t> Sequence;
+		T Item;
+	};
+
+	const size_t mask;
+	std::unique_ptr<Slot[]> slots;
+
+	//producers and consumers work on different cache lines
+	alignas(64) std::atomic<size_t> head;
+	alignas(64) std::atomic<size_t> tail;
+};
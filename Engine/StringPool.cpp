@@ -0,0 +1,80 @@
+#include "StringPool.hpp"
+
+#include <cstring>
+
+StringPool::StringPool(size_t _blockSize)
+	: blockSize(_blockSize),
+	  current(nullptr),
+	  remaining(0),
+	  stats{}
+{
+}
+
+PooledString StringPool::Intern(const std::string& s)
+{
+	++stats.InternCalls;
+
+	//std::string stores up to 15 characters without an allocation
+	if (s.length() > 15)
+	{
+		++stats.StringAllocations;
+	}
+
+	auto it = strings.find(PooledString(s.c_str(), s.length()));
+	if (it != std::end(strings))
+	{
+		return *it;
+	}
+
+	PooledString pooled(Allocate(s.c_str(), s.length()), s.length());
+	strings.insert(pooled);
+
+	++stats.UniqueStrings;
+	++stats.PoolAllocations;
+
+	return pooled;
+}
+
+PooledString StringPool::Store(const char* s, size_t length)
+{
+	return PooledString(Allocate(s, length), length);
+}
+
+const char* StringPool::Allocate(const char* s, size_t length)
+{
+	auto size = length + 1;
+	if (size > remaining)
+	{
+		//strings which are bigger than a block get their own block
+		auto newBlockSize = size > blockSize ? size : blockSize;
+
+		blocks.emplace_back(new char[newBlockSize]);
+		current = blocks.back().get();
+		remaining = newBlockSize;
+
+		++stats.Blocks;
+		++stats.PoolAllocations;
+	}
+
+	auto str = current;
+	std::memcpy(str, s, length);
+	str[length] = '\0';
+
+	current += size;
+	remaining -= size;
+	stats.Bytes += size;
+
+	return str;
+}
+
+size_t StringPool::Hash::operator()(const PooledString& s) const
+{
+	//FNV-1a
+	size_t hash = 2166136261u;
+	for (auto i = 0u; i < s.size(); ++i)
+	{
+		hash ^= static_cast<unsigned char>(s.c_str()[i]);
+		hash *= 16777619u;
+	}
+	return hash;
+}
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <ostream>
+#include <unordered_set>
+
+/// <summary>
+/// A null terminated string which is owned by a <see cref="StringPool" />.
+/// The string is valid as long as the pool exists.
+/// </summary>
+class PooledString
+{
+	friend class StringPool;
+
+public:
+	PooledString()
+		: str(""),
+		  length(0)
+	{
+	}
+
+	/// <summary>
+	/// Constructs a pooled string from a string literal which does not need to be interned.
+	/// </summary>
+	/// <param name="literal">The string literal.</param>
+	template<size_t N>
+	PooledString(const char (&literal)[N])
+		: str(literal),
+		  length(N - 1)
+	{
+	}
+
+	const char* c_str() const
+	{
+		return str;
+	}
+
+	size_t size() const
+	{
+		return length;
+	}
+
+	bool empty() const
+	{
+		return length == 0;
+	}
+
+	char back() const
+	{
+		return str[length - 1];
+	}
+
+	operator std::string() const
+	{
+		return std::string(str, length);
+	}
+
+	bool operator==(const PooledString& other) const
+	{
+		return length == other.length && std::char_traits<char>::compare(str, other.str, length) == 0;
+	}
+
+	bool operator!=(const PooledString& other) const
+	{
+		return !(*this == other);
+	}
+
+private:
+	PooledString(const char* _str, size_t _length)
+		: str(_str),
+		  length(_length)
+	{
+	}
+
+	const char* str;
+	size_t length;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const PooledString& s)
+{
+	//c_str respects the stream width
+	return os << s.c_str();
+}
+
+inline std::string operator+(const std::string& lhs, const PooledString& rhs)
+{
+	return std::string(lhs).append(rhs.c_str(), rhs.size());
+}
+
+inline std::string operator+(const PooledString& lhs, const std::string& rhs)
+{
+	return std::string(lhs).append(rhs);
+}
+
+inline std::string operator+(const char* lhs, const PooledString& rhs)
+{
+	return std::string(lhs).append(rhs.c_str(), rhs.size());
+}
+
+inline std::string operator+(const PooledString& lhs, const char* rhs)
+{
+	return std::string(lhs).append(rhs);
+}
+
+/// <summary>
+/// A monotonic arena which interns strings. Equal strings share the same memory.
+/// All strings are released at once when the pool gets destroyed.
+/// </summary>
+class StringPool
+{
+public:
+	/// <summary>
+	/// Constructor.
+	/// </summary>
+	/// <param name="blockSize">The size of the arena blocks.</param>
+	explicit StringPool(size_t blockSize = 64 * 1024);
+
+	StringPool(const StringPool&) = delete;
+	StringPool& operator=(const StringPool&) = delete;
+
+	/// <summary>
+	/// Gets the pooled copy of the string. The string gets copied into the arena if it is not already present.
+	/// </summary>
+	/// <param name="s">The string.</param>
+	/// <returns>The pooled string.</returns>
+	PooledString Intern(const std::string& s);
+
+	/// <summary>
+	/// Copies the string into the arena without looking for an equal string. Use this for strings which are known to be unique.
+	/// </summary>
+	/// <param name="s">The string.</param>
+	/// <param name="length">The length of the string.</param>
+	/// <returns>The pooled string.</returns>
+	PooledString Store(const char* s, size_t length);
+
+	struct Statistics
+	{
+		size_t InternCalls;
+		size_t UniqueStrings;
+		size_t Blocks;
+		size_t Bytes;
+
+		/// <summary>The heap allocations the interned strings would need as std::string (strings which don't fit into the small string buffer).</summary>
+		size_t StringAllocations;
+		/// <summary>The heap allocations of the pool (arena blocks and the nodes of the lookup table).</summary>
+		size_t PoolAllocations;
+	};
+
+	/// <summary>
+	/// Gets the allocation counters of the pool.
+	/// </summary>
+	/// <returns>The statistics.</returns>
+	Statistics GetStatistics() const
+	{
+		return stats;
+	}
+
+private:
+	struct Hash
+	{
+		size_t operator()(const PooledString& s) const;
+	};
+
+	/// <summary>
+	/// Copies the string into the arena.
+	/// </summary>
+	/// <param name="s">The string.</param>
+	/// <param name="length">The length of the string.</param>
+	/// <returns>The copy of the string.</returns>
+	const char* Allocate(const char* s, size_t length);
+
+	const size_t blockSize;
+	std::vector<std::unique_ptr<char[]>> blocks;
+	char* current;
+	size_t remaining;
+
+	std::unordered_set<PooledString, Hash> strings;
+
+	Statistics stats;
+};
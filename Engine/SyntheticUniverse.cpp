@@ -0,0 +1,309 @@
+#include "SyntheticUniverse.hpp"
+
+#include <algorithm>
+
+#include "GenericTypes.hpp"
+
+namespace
+{
+	uint32_t Align(uint32_t offset, uint32_t alignment)
+	{
+		return (offset + alignment - 1) / alignment * alignment;
+	}
+}
+
+SyntheticUniverse::SyntheticUniverse(const Options& _options)
+	: options(_options),
+	  random(_options.Seed)
+{
+	//name 0 is always None
+	AddName("None");
+
+	auto& layout = GetCoreLayout();
+
+	auto corePackage = AddObject(ObjectType::Package, layout.PackageName, InvalidIndex, InvalidIndex);
+
+	std::unordered_map<std::string, uint32_t> coreClasses;
+	for (auto&& coreClass : layout.Classes)
+	{
+		auto index = AddObject(ObjectType::Class, coreClass.Name, InvalidIndex, corePackage);
+		objects[index].Size = static_cast<uint32_t>(coreClass.Size);
+		if (coreClass.Super != nullptr)
+		{
+			objects[index].Super = coreClasses.at(coreClass.Super);
+		}
+
+		coreClasses[coreClass.Name] = index;
+	}
+
+	classClass = coreClasses.at("Class");
+	scriptStructClass = coreClasses.at("ScriptStruct");
+	functionClass = coreClasses.at("Function");
+	enumClass = coreClasses.at("Enum");
+	objectClass = coreClasses.at("Object");
+
+	auto packageClass = coreClasses.at("Package");
+
+	for (auto&& obj : objects)
+	{
+		obj.Class = obj.Type == ObjectType::Package ? packageClass : classClass;
+	}
+
+	propertyClasses[static_cast<size_t>(PropertyType::None)] = InvalidIndex;
+	propertyClasses[static_cast<size_t>(PropertyType::Byte)] = coreClasses.at("ByteProperty");
+	propertyClasses[static_cast<size_t>(PropertyType::Int)] = coreClasses.at("IntProperty");
+	propertyClasses[static_cast<size_t>(PropertyType::Float)] = coreClasses.at("FloatProperty");
+	propertyClasses[static_cast<size_t>(PropertyType::Bool)] = coreClasses.at("BoolProperty");
+	propertyClasses[static_cast<size_t>(PropertyType::Name)] = coreClasses.at("NameProperty");
+	propertyClasses[static_cast<size_t>(PropertyType::Str)] = coreClasses.at("StrProperty");
+	propertyClasses[static_cast<size_t>(PropertyType::Object)] = coreClasses.at("ObjectProperty");
+	propertyClasses[static_cast<size_t>(PropertyType::Struct)] = coreClasses.at("StructProperty");
+	propertyClasses[static_cast<size_t>(PropertyType::Array)] = coreClasses.at("ArrayProperty");
+
+	std::vector<uint32_t> packages;
+	for (auto i = 0u; i < (std::max)(options.PackageCount, static_cast<size_t>(1)); ++i)
+	{
+		packages.push_back(AddObject(ObjectType::Package, "SyntheticPackage" + std::to_string(i), packageClass, InvalidIndex));
+	}
+
+	auto depth = (std::max)(options.HierarchyDepth, static_cast<size_t>(1));
+
+	//every package has one inheritance chain which starts again at Object if it reaches the maximum depth
+	std::unordered_map<uint32_t, std::vector<uint32_t>> chains;
+
+	//every package gets blocks of eight structs and enums
+	for (auto i = 0u; objects.size() < options.ObjectCount; ++i)
+	{
+		auto package = packages[(i / 8) % packages.size()];
+
+		switch (i % 8)
+		{
+			case 3:
+			case 7:
+				AddStruct(ObjectType::ScriptStruct, package, InvalidIndex);
+				break;
+			case 5:
+				AddEnum(package);
+				break;
+			default:
+			{
+				auto& chain = chains[package];
+				if (chain.size() >= depth)
+				{
+					chain.clear();
+				}
+
+				auto super = chain.empty() ? objectClass : chain.back();
+				chain.push_back(AddStruct(ObjectType::Class, package, super));
+				break;
+			}
+		}
+	}
+}
+
+uint32_t SyntheticUniverse::AddName(const std::string& name)
+{
+	auto it = nameIds.find(name);
+	if (it != std::end(nameIds))
+	{
+		return it->second;
+	}
+
+	auto id = static_cast<uint32_t>(names.size());
+	names.push_back(name);
+	nameIds.emplace(name, id);
+
+	return id;
+}
+
+uint32_t SyntheticUniverse::AddObject(ObjectType type, const std::string& name, uint32_t classIndex, uint32_t outer)
+{
+	Object obj = {};
+	obj.Type = type;
+	obj.Property = PropertyType::None;
+	obj.Name = AddName(name);
+	obj.Class = classIndex;
+	obj.Outer = outer;
+	obj.Super = InvalidIndex;
+	obj.Children = InvalidIndex;
+	obj.Next = InvalidIndex;
+	obj.Reference = InvalidIndex;
+
+	objects.push_back(obj);
+
+	return static_cast<uint32_t>(objects.size() - 1);
+}
+
+void SyntheticUniverse::Link(uint32_t structIndex, uint32_t field, uint32_t& last)
+{
+	if (last == InvalidIndex)
+	{
+		objects[structIndex].Children = field;
+	}
+	else
+	{
+		objects[last].Next = field;
+	}
+	last = field;
+}
+
+uint32_t SyntheticUniverse::AddProperty(PropertyType type, const std::string& name, uint32_t outer, uint32_t reference, uint32_t& offset, uint64_t flags)
+{
+	const uint32_t pointerSize = sizeof(void*);
+
+	uint32_t size;
+	uint32_t alignment;
+	switch (type)
+	{
+		case PropertyType::Byte:
+			size = alignment = 1;
+			break;
+		case PropertyType::Int:
+		case PropertyType::Float:
+		case PropertyType::Bool:
+			size = alignment = 4;
+			break;
+		case PropertyType::Name:
+			size = 8;
+			alignment = 4;
+			break;
+		case PropertyType::Object:
+			size = alignment = pointerSize;
+			break;
+		case PropertyType::Struct:
+			size = objects[reference].Size;
+			alignment = 4;
+			break;
+		default: //Str, Array
+			size = pointerSize + 8;
+			alignment = pointerSize;
+			break;
+	}
+
+	offset = Align(offset, alignment);
+
+	auto index = AddObject(ObjectType::Property, name, propertyClasses[static_cast<size_t>(type)], outer);
+	auto& obj = objects[index];
+	obj.Property = type;
+	obj.Reference = reference;
+	obj.Size = size;
+	obj.Offset = offset;
+	obj.ArrayDim = 1;
+	obj.BitMask = type == PropertyType::Bool ? 1 : 0;
+	obj.Flags = flags;
+
+	offset += size;
+
+	if (type == PropertyType::Array)
+	{
+		uint32_t innerOffset = 0;
+		auto inner = AddProperty(PropertyType::Int, name, index, InvalidIndex, innerOffset, 0);
+		objects[index].Reference = inner;
+	}
+
+	return index;
+}
+
+uint32_t SyntheticUniverse::AddStruct(ObjectType type, uint32_t package, uint32_t super)
+{
+	auto isClass = type == ObjectType::Class;
+
+	auto index = AddObject(type, (isClass ? "SyntheticClass" : "SyntheticStruct") + std::to_string(objects.size()), isClass ? classClass : scriptStructClass, package);
+	objects[index].Super = super;
+
+	auto offset = super != InvalidIndex ? objects[super].Size : 0;
+	auto last = InvalidIndex;
+
+	for (auto i = 0u; i < options.PropertiesPerStruct; ++i)
+	{
+		auto propertyType = static_cast<PropertyType>(1 + Random(static_cast<uint32_t>(PropertyType::Array)));
+
+		auto reference = InvalidIndex;
+		switch (propertyType)
+		{
+			case PropertyType::Byte:
+			{
+				auto it = lastEnum.find(package);
+				if (it != std::end(lastEnum))
+				{
+					reference = it->second;
+				}
+				break;
+			}
+			case PropertyType::Object:
+				reference = classes.empty() ? objectClass : classes[Random(static_cast<uint32_t>(classes.size()))];
+				break;
+			case PropertyType::Struct:
+			{
+				auto it = lastScriptStruct.find(package);
+				if (it != std::end(lastScriptStruct))
+				{
+					reference = it->second;
+				}
+				else
+				{
+					propertyType = PropertyType::Int;
+				}
+				break;
+			}
+			default:
+				break;
+		}
+
+		auto property = AddProperty(propertyType, "Member" + std::to_string(i), index, reference, offset, static_cast<uint64_t>(UEPropertyFlags::CPF_Edit));
+		Link(index, property, last);
+	}
+
+	if (isClass)
+	{
+		auto function = AddObject(ObjectType::Function, "Execute", functionClass, index);
+		objects[function].Flags = static_cast<uint64_t>(UEFunctionFlags::FUNC_Native) | static_cast<uint64_t>(UEFunctionFlags::FUNC_Public);
+
+		auto parmsOffset = 0u;
+		auto lastParameter = InvalidIndex;
+
+		const auto parm = static_cast<uint64_t>(UEPropertyFlags::CPF_Parm);
+		const auto returnParm = parm | static_cast<uint64_t>(UEPropertyFlags::CPF_OutParm) | static_cast<uint64_t>(UEPropertyFlags::CPF_ReturnParm);
+
+		Link(function, AddProperty(PropertyType::Int, "Value", function, InvalidIndex, parmsOffset, parm), lastParameter);
+		Link(function, AddProperty(PropertyType::Object, "Target", function, index, parmsOffset, parm), lastParameter);
+		Link(function, AddProperty(PropertyType::Bool, "ReturnValue", function, InvalidIndex, parmsOffset, returnParm), lastParameter);
+
+		objects[function].Size = parmsOffset;
+
+		Link(index, function, last);
+
+		classes.push_back(index);
+	}
+	else
+	{
+		lastScriptStruct[package] = index;
+	}
+
+	objects[index].Size = Align(offset, 4);
+
+	return index;
+}
+
+uint32_t SyntheticUniverse::AddEnum(uint32_t package)
+{
+	auto index = AddObject(ObjectType::Enum, "SyntheticEnum" + std::to_string(objects.size()), enumClass, package);
+
+	auto& obj = objects[index];
+	obj.FirstValue = static_cast<uint32_t>(enumValues.size());
+	obj.ValueCount = 2 + Random(6);
+
+	for (auto i = 0u; i < obj.ValueCount; ++i)
+	{
+		enumValues.push_back(AddName("Value" + std::to_string(i)));
+	}
+
+	lastEnum[package] = index;
+
+	return index;
+}
+
+uint32_t SyntheticUniverse::Random(uint32_t count)
+{
+	return static_cast<uint32_t>(random() % count);
+}
@@ -0,0 +1,266 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <filesystem>
+namespace fs = std::experimental::filesystem;
+
+/// <summary>
+/// A deterministic object universe which is built by the generator instead of a game.
+/// The universe is described independently of the memory layout of the engine. A target which supports it creates
+/// its engine objects (EngineClasses.hpp) from the description and installs them into ObjectsStore and NamesStore.
+/// This way ObjectsStore, NamesStore, Package and ProcessPackages can be run and timed without injecting into a game.
+/// The description of the objects of a game can be captured and saved as snapshot file, so the SDK can be generated again without the game.
+/// </summary>
+class SyntheticUniverse
+{
+public:
+	struct Options
+	{
+		Options()
+			: ObjectCount(10000),
+			  HierarchyDepth(4),
+			  PackageCount(8),
+			  PropertiesPerStruct(8),
+			  Seed(1)
+		{
+		}
+
+		/// <summary>
+		/// The number of objects. The universe may contain a few more objects because structs are always complete.
+		/// </summary>
+		size_t ObjectCount;
+
+		/// <summary>
+		/// The maximum length of the class inheritance chains in a package.
+		/// </summary>
+		size_t HierarchyDepth;
+
+		size_t PackageCount;
+
+		size_t PropertiesPerStruct;
+
+		/// <summary>
+		/// The seed of the random generator. The same options always build the same universe.
+		/// </summary>
+		uint32_t Seed;
+	};
+
+	enum class ObjectType : uint8_t
+	{
+		/// <summary>A package or any other object which is not described by its own type.</summary>
+		Package,
+		Class,
+		ScriptStruct,
+		Function,
+		Enum,
+		Property
+	};
+
+	enum class PropertyType : uint8_t
+	{
+		/// <summary>A property without type information. It only keeps its offset, size and flags.</summary>
+		None,
+		Byte,
+		Int,
+		Float,
+		Bool,
+		Name,
+		Str,
+		Object,
+		Struct,
+		Array
+	};
+
+	/// <summary>
+	/// The description of an object. Object references are indices into the object list.
+	/// </summary>
+	struct Object
+	{
+		ObjectType Type;
+		PropertyType Property;
+		uint32_t Name;
+		uint32_t Class;
+		uint32_t Outer;
+
+		/// <summary>
+		/// Structs: the super struct.
+		/// </summary>
+		uint32_t Super;
+
+		/// <summary>
+		/// Structs: the first child field.
+		/// </summary>
+		uint32_t Children;
+
+		/// <summary>
+		/// Fields: the next field of the outer struct.
+		/// </summary>
+		uint32_t Next;
+
+		/// <summary>
+		/// Properties: the enum (Byte), the property class (Object), the struct (Struct) or the inner property (Array).
+		/// </summary>
+		uint32_t Reference;
+
+		/// <summary>
+		/// Structs: the property size. Properties: the element size.
+		/// </summary>
+		uint32_t Size;
+
+		uint32_t Offset;
+		uint32_t ArrayDim;
+		uint32_t BitMask;
+
+		/// <summary>
+		/// Functions: the function flags. Properties: the property flags.
+		/// </summary>
+		uint64_t Flags;
+
+		/// <summary>
+		/// Enums: the range of the value names in the enum value list.
+		/// </summary>
+		uint32_t FirstValue;
+		uint32_t ValueCount;
+	};
+
+	/// <summary>
+	/// A class of the core package.
+	/// </summary>
+	struct CoreClass
+	{
+		const char* Name;
+
+		/// <summary>
+		/// The name of the super class or nullptr.
+		/// </summary>
+		const char* Super;
+
+		/// <summary>
+		/// The size of the engine class (sizeof(UClass), ...).
+		/// </summary>
+		size_t Size;
+	};
+
+	/// <summary>
+	/// The core package of the target with all classes the generic types search with StaticClass().
+	/// The super classes must be listed before their subclasses. The layout must contain the classes Object, Class,
+	/// ScriptStruct, Function, Enum, Package and the property classes of PropertyType.
+	/// </summary>
+	struct CoreLayout
+	{
+		const char* PackageName;
+
+		std::vector<CoreClass> Classes;
+	};
+
+	static const uint32_t InvalidIndex = 0xFFFFFFFF;
+
+	/// <summary>
+	/// Creates an empty universe for <see cref="Capture()" /> and <see cref="Load()" />.
+	/// </summary>
+	SyntheticUniverse();
+
+	/// <summary>
+	/// Builds the description of a universe with the core layout of the target.
+	/// </summary>
+	/// <param name="options">The options.</param>
+	explicit SyntheticUniverse(const Options& options);
+
+	/// <summary>
+	/// Replaces the description with the objects of ObjectsStore (the game or an installed universe).
+	/// Properties of types which are not in <see cref="PropertyType" /> keep their offset, size and flags but lose their type.
+	/// Other fields (UE3 consts, ...) become plain objects. The names are stored as the generator reads them (including the number).
+	/// </summary>
+	void Capture();
+
+	/// <summary>
+	/// Saves the description as snapshot file.
+	/// </summary>
+	/// <param name="file">The file.</param>
+	/// <returns>true if it succeeds, false if it fails.</returns>
+	bool Save(const fs::path& file) const;
+
+	/// <summary>
+	/// Replaces the description with a snapshot file. Every reference must point at an object of the type <see cref="Install()" /> expects
+	/// and the outer, super and field chains must end, otherwise the file is rejected. The class of an object is only checked to be a class.
+	/// </summary>
+	/// <param name="file">The file.</param>
+	/// <returns>true if it succeeds, false if the file could not be read or is invalid.</returns>
+	bool Load(const fs::path& file);
+
+	const std::vector<std::string>& GetNames() const
+	{
+		return names;
+	}
+
+	const std::vector<Object>& GetObjects() const
+	{
+		return objects;
+	}
+
+	/// <summary>
+	/// Gets the name ids of the enum values.
+	/// </summary>
+	const std::vector<uint32_t>& GetEnumValues() const
+	{
+		return enumValues;
+	}
+
+	/// <summary>
+	/// Creates the engine objects and installs them into ObjectsStore and NamesStore. The objects live until the process exits.
+	/// Only one universe can be installed per process because the generic types and the stores cache names and classes.
+	/// This method is implemented by the target.
+	/// </summary>
+	/// <returns>true if it succeeds, false if it fails.</returns>
+	bool Install() const;
+
+	/// <summary>
+	/// Gets the core layout of the target. This method is implemented by the target.
+	/// </summary>
+	static const CoreLayout& GetCoreLayout();
+
+private:
+	uint32_t AddName(const std::string& name);
+
+	uint32_t AddObject(ObjectType type, const std::string& name, uint32_t classIndex, uint32_t outer);
+
+	/// <summary>
+	/// Appends a field to the children of a struct.
+	/// </summary>
+	void Link(uint32_t structIndex, uint32_t field, uint32_t& last);
+
+	uint32_t AddProperty(PropertyType type, const std::string& name, uint32_t outer, uint32_t reference, uint32_t& offset, uint64_t flags);
+
+	uint32_t AddStruct(ObjectType type, uint32_t package, uint32_t super);
+
+	uint32_t AddEnum(uint32_t package);
+
+	uint32_t Random(uint32_t count);
+
+	std::vector<std::string> names;
+	std::unordered_map<std::string, uint32_t> nameIds;
+	std::vector<Object> objects;
+	std::vector<uint32_t> enumValues;
+
+	Options options;
+	std::mt19937 random;
+
+	uint32_t classClass;
+	uint32_t scriptStructClass;
+	uint32_t functionClass;
+	uint32_t enumClass;
+	uint32_t objectClass;
+	uint32_t propertyClasses[static_cast<size_t>(PropertyType::Array) + 1];
+
+	/// <summary>
+	/// The last struct and enum which were added to a package. Properties only reference structs and enums
+	/// of their own package, so the generated packages have no circular dependencies.
+	/// </summary>
+	std::unordered_map<uint32_t, uint32_t> lastScriptStruct;
+	std::unordered_map<uint32_t, uint32_t> lastEnum;
+	std::vector<uint32_t> classes;
+};
@@ -0,0 +1,445 @@
+#include "SyntheticUniverse.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "ObjectsStore.hpp"
+
+namespace
+{
+	const char Magic[8] = { 'U', 'E', 'S', 'D', 'K', 'S', 'N', '\0' };
+
+	const uint32_t Version = 1;
+
+	struct Header
+	{
+		char Magic[8];
+		uint32_t Version;
+		uint32_t NameCount;
+		uint32_t ObjectCount;
+		uint32_t EnumValueCount;
+	};
+}
+
+//the objects are written as they are in memory
+static_assert(sizeof(SyntheticUniverse::Object) == 64, "the layout of SyntheticUniverse::Object is part of the snapshot format");
+
+SyntheticUniverse::SyntheticUniverse()
+	: classClass(InvalidIndex),
+	  scriptStructClass(InvalidIndex),
+	  functionClass(InvalidIndex),
+	  enumClass(InvalidIndex),
+	  objectClass(InvalidIndex)
+{
+}
+
+void SyntheticUniverse::Capture()
+{
+	names.clear();
+	nameIds.clear();
+	objects.clear();
+	enumValues.clear();
+
+	auto addName = [this](const std::string& name)
+	{
+		auto it = nameIds.find(name);
+		if (it != std::end(nameIds))
+		{
+			return it->second;
+		}
+
+		auto id = static_cast<uint32_t>(names.size());
+		names.push_back(name);
+		nameIds.emplace(name, id);
+		return id;
+	};
+
+	//name 0 is always None
+	addName("None");
+
+	//the object table of a game has holes, the description gets consecutive indices
+	std::vector<UEObject> engineObjects;
+	std::unordered_map<void*, uint32_t> indices;
+	for (auto&& info : ObjectsStore())
+	{
+		indices.emplace(info.Object.GetAddress(), static_cast<uint32_t>(engineObjects.size()));
+		engineObjects.push_back(info.Object);
+	}
+
+	auto indexOf = [&indices](const UEObject& obj)
+	{
+		if (!obj.IsValid())
+		{
+			return InvalidIndex;
+		}
+		auto it = indices.find(obj.GetAddress());
+		return it != std::end(indices) ? it->second : InvalidIndex;
+	};
+
+	//only these fields are recreated by Install(), all others are skipped in the field lists
+	auto isDescribed = [](const UEObject& obj)
+	{
+		return obj.IsA<UEStruct>() || obj.IsA<UEEnum>() || obj.IsA<UEProperty>();
+	};
+	auto nextDescribed = [&](UEField field)
+	{
+		while (field.IsValid() && !isDescribed(field))
+		{
+			field = field.GetNext();
+		}
+		return indexOf(field);
+	};
+
+	//objects without a matching engine type get a base class, so IsA<T>() never reads fields which were not captured
+	auto plainObjectClass = indexOf(UEObject::StaticClass());
+	auto plainPropertyClass = indexOf(UEProperty::StaticClass());
+
+	objects.reserve(engineObjects.size());
+	for (auto&& obj : engineObjects)
+	{
+		Object description = {};
+		description.Type = ObjectType::Package;
+		description.Property = PropertyType::None;
+		description.Name = addName(obj.GetName());
+		description.Class = indexOf(obj.GetClass());
+		description.Outer = indexOf(obj.GetOuter());
+		description.Super = InvalidIndex;
+		description.Children = InvalidIndex;
+		description.Next = InvalidIndex;
+		description.Reference = InvalidIndex;
+
+		if (!isDescribed(obj))
+		{
+			if (obj.IsA<UEField>())
+			{
+				description.Class = plainObjectClass;
+			}
+			objects.push_back(description);
+			continue;
+		}
+
+		description.Next = nextDescribed(obj.Cast<UEField>().GetNext());
+
+		if (obj.IsA<UEStruct>())
+		{
+			auto structObj = obj.Cast<UEStruct>();
+			description.Type = obj.IsA<UEClass>() ? ObjectType::Class : obj.IsA<UEFunction>() ? ObjectType::Function : ObjectType::ScriptStruct;
+			description.Super = indexOf(structObj.GetSuper());
+			description.Children = nextDescribed(structObj.GetChildren());
+			description.Size = static_cast<uint32_t>(structObj.GetPropertySize());
+
+			if (description.Type == ObjectType::Function)
+			{
+				auto function = obj.Cast<UEFunction>();
+				description.Flags = static_cast<uint64_t>(function.GetFunctionFlags());
+				description.Size = static_cast<uint32_t>(function.GetParmsSize());
+			}
+		}
+		else if (obj.IsA<UEEnum>())
+		{
+			description.Type = ObjectType::Enum;
+			description.FirstValue = static_cast<uint32_t>(enumValues.size());
+			for (auto&& value : obj.Cast<UEEnum>().GetNames())
+			{
+				enumValues.push_back(addName(value));
+			}
+			description.ValueCount = static_cast<uint32_t>(enumValues.size()) - description.FirstValue;
+		}
+		else
+		{
+			auto prop = obj.Cast<UEProperty>();
+			description.Type = ObjectType::Property;
+			description.Size = static_cast<uint32_t>(prop.GetElementSize());
+			description.Offset = static_cast<uint32_t>(prop.GetOffset());
+			description.ArrayDim = static_cast<uint32_t>(prop.GetArrayDim());
+			description.Flags = static_cast<uint64_t>(prop.GetPropertyFlags());
+
+			if (prop.IsA<UEByteProperty>())
+			{
+				description.Property = PropertyType::Byte;
+				description.Reference = indexOf(prop.Cast<UEByteProperty>().GetEnum());
+			}
+			else if (prop.IsA<UEIntProperty>())
+			{
+				description.Property = PropertyType::Int;
+			}
+			else if (prop.IsA<UEFloatProperty>())
+			{
+				description.Property = PropertyType::Float;
+			}
+			else if (prop.IsA<UEBoolProperty>())
+			{
+				description.Property = PropertyType::Bool;
+				description.BitMask = static_cast<uint32_t>(prop.Cast<UEBoolProperty>().GetBitMask());
+			}
+			else if (prop.IsA<UENameProperty>())
+			{
+				description.Property = PropertyType::Name;
+			}
+			else if (prop.IsA<UEStrProperty>())
+			{
+				description.Property = PropertyType::Str;
+			}
+			else if (prop.GetClass() == UEObjectProperty::StaticClass())
+			{
+				//subclasses (class properties, ...) have more fields
+				description.Property = PropertyType::Object;
+				description.Reference = indexOf(prop.Cast<UEObjectProperty>().GetPropertyClass());
+			}
+			else if (prop.IsA<UEStructProperty>())
+			{
+				description.Property = PropertyType::Struct;
+				description.Reference = indexOf(prop.Cast<UEStructProperty>().GetStruct());
+			}
+			else if (prop.IsA<UEArrayProperty>())
+			{
+				description.Property = PropertyType::Array;
+				description.Reference = indexOf(prop.Cast<UEArrayProperty>().GetInner());
+			}
+
+			//an object, struct or array property without its class, struct or inner property can not be recreated
+			auto needsReference = description.Property == PropertyType::Object || description.Property == PropertyType::Struct || description.Property == PropertyType::Array;
+			if (description.Property == PropertyType::None || (needsReference && description.Reference == InvalidIndex))
+			{
+				description.Property = PropertyType::None;
+				description.Reference = InvalidIndex;
+				description.Class = plainPropertyClass;
+			}
+		}
+
+		objects.push_back(description);
+	}
+}
+
+bool SyntheticUniverse::Save(const fs::path& file) const
+{
+	std::ofstream os(file, std::ios::binary);
+	if (!os)
+	{
+		return false;
+	}
+
+	Header header = {};
+	std::memcpy(header.Magic, Magic, sizeof(Magic));
+	header.Version = Version;
+	header.NameCount = static_cast<uint32_t>(names.size());
+	header.ObjectCount = static_cast<uint32_t>(objects.size());
+	header.EnumValueCount = static_cast<uint32_t>(enumValues.size());
+	os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	for (auto&& name : names)
+	{
+		auto length = static_cast<uint32_t>(name.length());
+		os.write(reinterpret_cast<const char*>(&length), sizeof(length));
+		os.write(name.data(), length);
+	}
+
+	os.write(reinterpret_cast<const char*>(objects.data()), objects.size() * sizeof(Object));
+	os.write(reinterpret_cast<const char*>(enumValues.data()), enumValues.size() * sizeof(uint32_t));
+
+	return static_cast<bool>(os);
+}
+
+bool SyntheticUniverse::Load(const fs::path& file)
+{
+	std::ifstream is(file, std::ios::binary);
+	if (!is)
+	{
+		return false;
+	}
+	std::vector<char> data((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+
+	size_t position = 0;
+	auto read = [&](void* buffer, uint64_t size)
+	{
+		if (size > data.size() - position)
+		{
+			return false;
+		}
+		std::memcpy(buffer, data.data() + position, static_cast<size_t>(size));
+		position += static_cast<size_t>(size);
+		return true;
+	};
+
+	Header header;
+	if (!read(&header, sizeof(header)) || std::memcmp(header.Magic, Magic, sizeof(Magic)) != 0 || header.Version != Version)
+	{
+		return false;
+	}
+
+	//every name has at least its length, so a corrupt count is rejected before the names are allocated
+	if (static_cast<uint64_t>(header.NameCount) * sizeof(uint32_t) > data.size() - position)
+	{
+		return false;
+	}
+
+	std::vector<std::string> loadedNames(header.NameCount);
+	for (auto&& name : loadedNames)
+	{
+		uint32_t length;
+		if (!read(&length, sizeof(length)) || length > data.size() - position)
+		{
+			return false;
+		}
+		name.assign(data.data() + position, length);
+		position += length;
+	}
+
+	std::vector<Object> loadedObjects;
+	std::vector<uint32_t> loadedEnumValues;
+	if (static_cast<uint64_t>(header.ObjectCount) * sizeof(Object) > data.size() - position)
+	{
+		return false;
+	}
+	loadedObjects.resize(header.ObjectCount);
+	if (!read(loadedObjects.data(), static_cast<uint64_t>(header.ObjectCount) * sizeof(Object)))
+	{
+		return false;
+	}
+	if (static_cast<uint64_t>(header.EnumValueCount) * sizeof(uint32_t) > data.size() - position)
+	{
+		return false;
+	}
+	loadedEnumValues.resize(header.EnumValueCount);
+	if (!read(loadedEnumValues.data(), static_cast<uint64_t>(header.EnumValueCount) * sizeof(uint32_t)) || position != data.size())
+	{
+		return false;
+	}
+
+	//Install() casts the references to the engine types and the generator follows the chains without checks
+	auto isType = [&](uint32_t index, std::initializer_list<ObjectType> types)
+	{
+		return index < loadedObjects.size() && std::find(std::begin(types), std::end(types), loadedObjects[index].Type) != std::end(types);
+	};
+	auto isStruct = [&](uint32_t index)
+	{
+		return isType(index, { ObjectType::Class, ObjectType::ScriptStruct, ObjectType::Function });
+	};
+	auto isField = [&](uint32_t index)
+	{
+		return isType(index, { ObjectType::Class, ObjectType::ScriptStruct, ObjectType::Function, ObjectType::Enum, ObjectType::Property });
+	};
+
+	for (auto&& obj : loadedObjects)
+	{
+		if (obj.Type > ObjectType::Property || obj.Property > PropertyType::Array || obj.Name >= loadedNames.size()
+			|| (obj.Class != InvalidIndex && !isType(obj.Class, { ObjectType::Class }))
+			|| (obj.Outer != InvalidIndex && obj.Outer >= loadedObjects.size()))
+		{
+			return false;
+		}
+		if (obj.Type == ObjectType::Package)
+		{
+			continue;
+		}
+
+		if (obj.Next != InvalidIndex && !isField(obj.Next))
+		{
+			return false;
+		}
+
+		switch (obj.Type)
+		{
+			case ObjectType::Class:
+			case ObjectType::ScriptStruct:
+			case ObjectType::Function:
+				if ((obj.Super != InvalidIndex && !isStruct(obj.Super)) || (obj.Children != InvalidIndex && !isField(obj.Children)))
+				{
+					return false;
+				}
+				break;
+			case ObjectType::Enum:
+				if (static_cast<uint64_t>(obj.FirstValue) + obj.ValueCount > loadedEnumValues.size())
+				{
+					return false;
+				}
+				break;
+			case ObjectType::Property:
+			{
+				auto valid = true;
+				switch (obj.Property)
+				{
+					case PropertyType::Byte:
+						valid = obj.Reference == InvalidIndex || isType(obj.Reference, { ObjectType::Enum });
+						break;
+					case PropertyType::Object:
+						valid = isType(obj.Reference, { ObjectType::Class });
+						break;
+					case PropertyType::Struct:
+						valid = isType(obj.Reference, { ObjectType::ScriptStruct });
+						break;
+					case PropertyType::Array:
+						valid = isType(obj.Reference, { ObjectType::Property });
+						break;
+					default:
+						valid = obj.Reference == InvalidIndex;
+						break;
+				}
+				if (!valid)
+				{
+					return false;
+				}
+				break;
+			}
+			default:
+				break;
+		}
+	}
+
+	//the outer, super, field and inner property chains must end
+	auto hasCycle = [&](uint32_t Object::* member, bool (*follow)(const Object&))
+	{
+		//0 = not visited, 1 = on the current chain, 2 = the chain ends
+		std::vector<uint8_t> state(loadedObjects.size());
+		std::vector<uint32_t> chain;
+		for (auto i = 0u; i < loadedObjects.size(); ++i)
+		{
+			auto index = i;
+			while (index != InvalidIndex && state[index] == 0 && follow(loadedObjects[index]))
+			{
+				state[index] = 1;
+				chain.push_back(index);
+				index = loadedObjects[index].*member;
+			}
+			if (index != InvalidIndex && state[index] == 1)
+			{
+				return true;
+			}
+			for (auto visited : chain)
+			{
+				state[visited] = 2;
+			}
+			chain.clear();
+		}
+		return false;
+	};
+	if (hasCycle(&Object::Outer, [](const Object&) { return true; })
+		|| hasCycle(&Object::Super, [](const Object& obj) { return obj.Type != ObjectType::Package && obj.Type != ObjectType::Enum && obj.Type != ObjectType::Property; })
+		|| hasCycle(&Object::Next, [](const Object& obj) { return obj.Type != ObjectType::Package; })
+		|| hasCycle(&Object::Reference, [](const Object& obj) { return obj.Type == ObjectType::Property && obj.Property == PropertyType::Array; }))
+	{
+		return false;
+	}
+
+	for (auto&& value : loadedEnumValues)
+	{
+		if (value >= loadedNames.size())
+		{
+			return false;
+		}
+	}
+
+	names = std::move(loadedNames);
+	objects = std::move(loadedObjects);
+	enumValues = std::move(loadedEnumValues);
+
+	nameIds.clear();
+	for (auto i = 0u; i < names.size(); ++i)
+	{
+		nameIds.emplace(names[i], i);
+	}
+
+	return true;
+}
@@ -1,5 +1,6 @@
 #include "GenericTypes.hpp"
 #include "../NameValidator.hpp"
+#include "../NamesStore.hpp"
 
 void* UEObject::GetAddress() const
 {
@@ -20,6 +21,8 @@ UEObject UEObject::GetPackageObject() const
 
 std::string UEObject::GetFullName() const
 {
+	Profiler::Increment(Profiler::Counter::GetFullNameCalls);
+
 	if (GetClass().IsValid())
 	{
 		std::string temp;
@@ -46,16 +49,18 @@ std::string UEObject::GetNameCPP() const
 
 	if (IsA<UEClass>())
 	{
+		static const auto actorId = NamesStore().FindId("Actor");
+		static const auto objectId = NamesStore().FindId("Object");
+
 		auto c = Cast<UEClass>();
 		while (c.IsValid())
 		{
-			auto className = c.GetName();
-			if (className == "Actor")
+			if (c.HasName(actorId))
 			{
 				name += "A";
 				break;
 			}
-			else if (className == "Object")
+			else if (c.HasName(objectId))
 			{
 				name += "U";
 				break;
@@ -76,6 +81,8 @@ std::string UEObject::GetNameCPP() const
 
 UEProperty::Info UEProperty::GetInfo() const
 {
+	Profiler::Increment(Profiler::Counter::GetInfoCalls);
+
 	if (IsValid())
 	{
 		if (IsA<UEPointerProperty>())
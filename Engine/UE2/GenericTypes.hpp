@@ -5,6 +5,7 @@
 
 #include "Flags.hpp"
 #include "../IGenerator.hpp"
+#include "../Profiler.hpp"
 
 class UObject;
 class UEClass;
@@ -34,6 +35,10 @@ public:
 
 	std::string GetName() const;
 
+	size_t GetNameId() const;
+
+	bool HasName(size_t nameId) const;
+
 	std::string GetFullName() const;
 
 	std::string GetNameCPP() const;
@@ -132,6 +137,8 @@ public:
 
 	UEFunctionFlags GetFunctionFlags() const;
 
+	size_t GetParmsSize() const;
+
 	static UEClass StaticClass();
 };
 
@@ -252,6 +259,8 @@ class UEObjectProperty : public UEProperty
 public:
 	using UEProperty::UEProperty;
 
+	UEClass GetPropertyClass() const;
+
 	UEProperty::Info GetInfo() const;
 
 	static UEClass StaticClass();
@@ -353,6 +362,8 @@ public:
 template<typename T>
 bool UEObject::IsA() const
 {
+	Profiler::Increment(Profiler::Counter::IsACalls);
+
 	auto cmp = T::StaticClass();
 	if (!cmp.IsValid())
 	{
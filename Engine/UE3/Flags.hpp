@@ -55,7 +55,7 @@ inline bool operator&(UEPropertyFlags lhs, UEPropertyFlags rhs)
 	return (static_cast<std::underlying_type_t<UEPropertyFlags>>(lhs) & static_cast<std::underlying_type_t<UEPropertyFlags>>(rhs)) != 0;
 }
 
-std::string StringifyFlags(UEPropertyFlags flags);
+const std::string& StringifyFlags(UEPropertyFlags flags);
 
 enum class UEFunctionFlags : uint32_t
 {
@@ -94,4 +94,4 @@ inline bool operator&(UEFunctionFlags lhs, UEFunctionFlags rhs)
 	return (static_cast<std::underlying_type_t<UEFunctionFlags>>(lhs) & static_cast<std::underlying_type_t<UEFunctionFlags>>(rhs)) != 0;
 }
 
-std::string StringifyFlags(UEFunctionFlags flags);
+const std::string& StringifyFlags(UEFunctionFlags flags);
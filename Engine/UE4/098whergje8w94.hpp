@@ -66,7 +66,7 @@ inline bool operator&(UEPropertyFlags lhs, UEPropertyFlags rhs)
 /// </summary>
 /// <param name="flags">The flags.</param>
 /// <returns>The string representation of the flags.</returns>
-std::string StringifyFlags(UEPropertyFlags flags);
+const std::string& StringifyFlags(UEPropertyFlags flags);
 
 enum class UEFunctionFlags : uint32_t
 {
@@ -110,4 +110,4 @@ inline bool operator&(UEFunctionFlags lhs, UEFunctionFlags rhs)
 /// </summary>
 /// <param name="flags">The flags.</param>
 /// <returns>The string representation of the flags.</returns>
-std::string StringifyFlags(UEFunctionFlags flags);
+const std::string& StringifyFlags(UEFunctionFlags flags);
@@ -5,6 +5,7 @@
 
 #include "Flags.hpp"
 #include "../IGenerator.hpp"
+#include "../Profiler.hpp"
 
 class UObject;
 class UEClass;
@@ -34,6 +35,10 @@ public:
 
 	std::string GetName() const;
 
+	size_t GetNameId() const;
+
+	bool HasName(size_t nameId) const;
+
 	std::string GetFullName() const;
 
 	std::string GetNameCPP() const;
@@ -132,6 +137,8 @@ public:
 
 	UEFunctionFlags GetFunctionFlags() const;
 
+	size_t GetParmsSize() const;
+
 	static UEClass StaticClass();
 };
 
@@ -487,6 +494,8 @@ public:
 template<typename T>
 bool UEObject::IsA() const
 {
+	Profiler::Increment(Profiler::Counter::IsACalls);
+
 	auto cmp = T::StaticClass();
 	if (!cmp.IsValid())
 	{
@@ -0,0 +1,102 @@
+#include "Utf8.hpp"
+
+#include <cwchar>
+#include <cstdint>
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define UTF8_USE_SSE2
+#endif
+
+static_assert(sizeof(wchar_t) == 2, "wchar_t must be UTF-16");
+
+/// <summary>
+/// Converts as many ASCII characters as possible.
+/// </summary>
+/// <param name="in">[in,out] The input. Points to the first non converted character.</param>
+/// <param name="end">The end of the input.</param>
+/// <param name="out">[in,out] The output. Points behind the last converted character.</param>
+static void ConvertAscii(const wchar_t*& in, const wchar_t* end, char*& out)
+{
+#ifdef UTF8_USE_SSE2
+	const auto asciiMask = _mm_set1_epi16(static_cast<short>(0xFF80));
+	const auto zero = _mm_setzero_si128();
+
+	//8 characters per step
+	while (end - in >= 8)
+	{
+		auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chars, asciiMask), zero)) != 0xFFFF)
+		{
+			break;
+		}
+
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(chars, chars));
+
+		in += 8;
+		out += 8;
+	}
+#endif
+
+	while (in != end && *in < 0x80)
+	{
+		*out++ = static_cast<char>(*in++);
+	}
+}
+
+std::string Utf16ToUtf8(const wchar_t* str, size_t length)
+{
+	//every UTF-16 character needs at most 3 bytes (surrogate pairs need 4 bytes for 2 characters)
+	std::string result(length * 3, '\0');
+
+	auto in = str;
+	auto end = str + length;
+	auto out = &result[0];
+
+	while (in != end)
+	{
+		ConvertAscii(in, end, out);
+		if (in == end)
+		{
+			break;
+		}
+
+		uint32_t c = static_cast<uint16_t>(*in++);
+		if (c >= 0xD800 && c <= 0xDFFF)
+		{
+			if (c <= 0xDBFF && in != end && *in >= 0xDC00 && *in <= 0xDFFF)
+			{
+				c = 0x10000 + ((c - 0xD800) << 10) + (static_cast<uint16_t>(*in++) - 0xDC00);
+			}
+			else
+			{
+				c = 0xFFFD;
+			}
+		}
+
+		if (c < 0x800)
+		{
+			*out++ = static_cast<char>(0xC0 | (c >> 6));
+		}
+		else if (c < 0x10000)
+		{
+			*out++ = static_cast<char>(0xE0 | (c >> 12));
+			*out++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+		}
+		else
+		{
+			*out++ = static_cast<char>(0xF0 | (c >> 18));
+			*out++ = static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+			*out++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+		}
+		*out++ = static_cast<char>(0x80 | (c & 0x3F));
+	}
+
+	result.resize(out - result.data());
+
+	return result;
+}
+
+std::string Utf16ToUtf8(const wchar_t* str)
+{
+	return Utf16ToUtf8(str, std::wcslen(str));
+}
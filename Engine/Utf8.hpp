@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string>
+
+/// <summary>
+/// Converts an UTF-16 string to UTF-8. Invalid surrogates are replaced with U+FFFD.
+/// Blocks of ASCII characters are converted without decoding every character.
+/// </summary>
+/// <param name="str">The UTF-16 string.</param>
+/// <param name="length">The length of the string in characters.</param>
+/// <returns>The UTF-8 string.</returns>
+std::string Utf16ToUtf8(const wchar_t* str, size_t length);
+
+/// <summary>
+/// Converts a null terminated UTF-16 string to UTF-8.
+/// </summary>
+/// <param name="str">The UTF-16 string.</param>
+/// <returns>The UTF-8 string.</returns>
+std::string Utf16ToUtf8(const wchar_t* str);
@@ -2,6 +2,7 @@
 
 #include "PatternFinder.hpp"
 #include "NamesStore.hpp"
+#include "Utf8.hpp"
 
 #include "EngineClasses.hpp"
 
@@ -39,6 +40,18 @@ public:
 	{
 		return WideName;
 	}
+
+	std::string GetName() const
+	{
+		if (IsWide())
+		{
+			return Utf16ToUtf8(WideName);
+		}
+		else
+		{
+			return AnsiName;
+		}
+	}
 };
 
 template<typename ElementType, int32_t MaxTotalElements, int32_t ElementsPerChunk>
@@ -109,5 +122,5 @@ bool NamesStore::IsValid(size_t id) const
 
 std::string NamesStore::GetById(size_t id) const
 {
-	return GlobalNames->GetById(static_cast<int32_t>(id))->GetAnsiName();
+	return GlobalNames->GetById(static_cast<int32_t>(id))->GetName();
 }
@@ -217,6 +217,56 @@ inline Fn GetVFunction(const void *instance, std::size_t index)
 	return reinterpret_cast<Fn>(vtable[index]);
 }
 
+//Converts an UTF-16 string to UTF-8, ASCII characters are copied directly
+inline std::string Utf16ToUtf8(const wchar_t* str)
+{
+	auto length = std::wcslen(str);
+
+	std::string result;
+	result.reserve(length);
+
+	for (auto i = 0u; i < length; ++i)
+	{
+		uint32_t c = static_cast<uint16_t>(str[i]);
+		if (c < 0x80)
+		{
+			result += static_cast<char>(c);
+			continue;
+		}
+
+		if (c >= 0xD800 && c <= 0xDFFF)
+		{
+			if (c <= 0xDBFF && i + 1 < length && str[i + 1] >= 0xDC00 && str[i + 1] <= 0xDFFF)
+			{
+				c = 0x10000 + ((c - 0xD800) << 10) + (static_cast<uint16_t>(str[++i]) - 0xDC00);
+			}
+			else
+			{
+				c = 0xFFFD;
+			}
+		}
+
+		if (c < 0x800)
+		{
+			result += static_cast<char>(0xC0 | (c >> 6));
+		}
+		else if (c < 0x10000)
+		{
+			result += static_cast<char>(0xE0 | (c >> 12));
+			result += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+		}
+		else
+		{
+			result += static_cast<char>(0xF0 | (c >> 18));
+			result += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+			result += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+		}
+		result += static_cast<char>(0x80 | (c & 0x3F));
+	}
+
+	return result;
+}
+
 template<class T>
 struct TArray
 {
@@ -314,6 +364,15 @@ public:
 	{
 		return WideName;
 	}
+
+	inline std::string GetName() const
+	{
+		if (IsWide())
+		{
+			return Utf16ToUtf8(WideName);
+		}
+		return AnsiName;
+	}
 };
 
 template<typename ElementType, int32_t MaxTotalElements, int32_t ElementsPerChunk>
@@ -420,9 +479,9 @@ struct FName
 		return *GNames;
 	};
 
-	inline const char* GetName() const
+	inline std::string GetName() const
 	{
-		return GetGlobalNames()[ComparisonIndex]->GetAnsiName();
+		return GetGlobalNames()[ComparisonIndex]->GetName();
 	};
 
 	inline bool operator==(const FName &other) const
@@ -459,13 +518,7 @@ struct FString : private TArray<wchar_t>
 
 	std::string ToString() const
 	{
-		auto length = std::wcslen(Data);
-
-		std::string str(length, '\0');
-
-		std::use_facet<std::ctype<wchar_t>>(std::locale()).narrow(Data, Data + length, '?', &str[0]);
-
-		return str;
+		return Utf16ToUtf8(Data);
 	}
 };
 
@@ -26,12 +26,17 @@ UEObject UEObject::GetOuter() const
 //---------------------------------------------------------------------------
 std::string UEObject::GetName() const
 {
-	auto name = NamesStore().GetById(object->Name.Index);
-	if (object->Name.Number > 0)
-	{
-		name += '_' + std::to_string(object->Name.Number);
-	}
-	return name;
+	return NamesStore().GetDisplayName(object->Name.Index, object->Name.Number, false);
+}
+//---------------------------------------------------------------------------
+size_t UEObject::GetNameId() const
+{
+	return static_cast<size_t>(object->Name.Index);
+}
+//---------------------------------------------------------------------------
+bool UEObject::HasName(size_t nameId) const
+{
+	return static_cast<size_t>(object->Name.Index) == nameId && object->Name.Number <= 0;
 }
 //---------------------------------------------------------------------------
 UEClass UEObject::StaticClass()
@@ -62,7 +67,7 @@ std::vector<std::string> UEEnum::GetNames() const
 
 	for (auto i = 0u; i < names.Num(); ++i)
 	{
-		buffer.push_back(NamesStore().GetById(names[i].Index));
+		buffer.push_back(NamesStore().GetCachedById(names[i].Index));
 	}
 
 	return buffer;
@@ -125,6 +130,11 @@ UEFunctionFlags UEFunction::GetFunctionFlags() const
 	return static_cast<UEFunctionFlags>(static_cast<UFunction*>(object)->FunctionFlags);
 }
 //---------------------------------------------------------------------------
+size_t UEFunction::GetParmsSize() const
+{
+	return static_cast<UFunction*>(object)->ParmsSize;
+}
+//---------------------------------------------------------------------------
 UEClass UEFunction::StaticClass()
 {
 	static auto c = ObjectsStore().FindClass("Class Core.Function");
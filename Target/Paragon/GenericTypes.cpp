@@ -26,19 +26,17 @@ UEObject UEObject::GetOuter() const
 //---------------------------------------------------------------------------
 std::string UEObject::GetName() const
 {
-	auto name = NamesStore().GetById(object->Name.ComparisonIndex);
-	if (object->Name.Number > 0)
-	{
-		name += '_' + std::to_string(object->Name.Number);
-	}
-
-	auto pos = name.rfind('/');
-	if (pos == std::string::npos)
-	{
-		return name;
-	}
-
-	return name.substr(pos + 1);
+	return NamesStore().GetDisplayName(object->Name.ComparisonIndex, object->Name.Number, true);
+}
+//---------------------------------------------------------------------------
+size_t UEObject::GetNameId() const
+{
+	return static_cast<size_t>(object->Name.ComparisonIndex);
+}
+//---------------------------------------------------------------------------
+bool UEObject::HasName(size_t nameId) const
+{
+	return static_cast<size_t>(object->Name.ComparisonIndex) == nameId && object->Name.Number <= 0;
 }
 //---------------------------------------------------------------------------
 UEClass UEObject::StaticClass()
@@ -69,7 +67,7 @@ std::vector<std::string> UEEnum::GetNames() const
 
 	for (auto i = 0; i < names.Num(); ++i)
 	{
-		buffer.push_back(NamesStore().GetById(names[i].Key.ComparisonIndex));
+		buffer.push_back(NamesStore().GetCachedById(names[i].Key.ComparisonIndex));
 	}
 
 	return buffer;
@@ -132,6 +130,11 @@ UEFunctionFlags UEFunction::GetFunctionFlags() const
 	return static_cast<UEFunctionFlags>(static_cast<UFunction*>(object)->FunctionFlags);
 }
 //---------------------------------------------------------------------------
+size_t UEFunction::GetParmsSize() const
+{
+	return static_cast<UFunction*>(object)->ParmsSize;
+}
+//---------------------------------------------------------------------------
 UEClass UEFunction::StaticClass()
 {
 	static auto c = ObjectsStore().FindClass("Class CoreUObject.Function");
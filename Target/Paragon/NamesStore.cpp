@@ -2,11 +2,15 @@
 
 #include "PatternFinder.hpp"
 #include "NamesStore.hpp"
+#include "Utf8.hpp"
 
 #include "EngineClasses.hpp"
 
 class FNameEntry
 {
+	static const auto NAME_WIDE_MASK = 0x1;
+	static const auto NAME_INDEX_SHIFT = 1;
+
 public:
 	__int32 Index;
 	char pad_0x0004[0x4];
@@ -17,9 +21,21 @@ public:
 		wchar_t WideName[1024];
 	};
 
-	const char* GetName() const
+	inline bool IsWide() const
+	{
+		return Index & NAME_WIDE_MASK;
+	}
+
+	std::string GetName() const
 	{
-		return AnsiName;
+		if (IsWide())
+		{
+			return Utf16ToUtf8(WideName);
+		}
+		else
+		{
+			return AnsiName;
+		}
 	}
 };
 
@@ -2,6 +2,7 @@
 
 #include "PatternFinder.hpp"
 #include "NamesStore.hpp"
+#include "Utf8.hpp"
 
 #include "EngineClasses.hpp"
 
@@ -44,13 +45,7 @@ public:
 	{
 		if (IsWide())
 		{
-			auto length = std::wcslen(WideName);
-
-			std::string str(length, '\0');
-
-			std::use_facet<std::ctype<wchar_t>>(std::locale()).narrow(WideName, WideName + length, '?', &str[0]);
-
-			return str;
+			return Utf16ToUtf8(WideName);
 		}
 		else
 		{
@@ -4,6 +4,8 @@
 #include <string>
 #include <windows.h>
 
+#include "Utf8.hpp"
+
 struct FPointer
 {
 	uintptr_t Dummy;
@@ -62,10 +64,7 @@ struct FString : public TArray<wchar_t>
 {
 	std::string ToString() const
 	{
-		int size = WideCharToMultiByte(CP_UTF8, 0, Data, Count - 1, nullptr, 0, nullptr, nullptr);
-		std::string str(size, 0);
-		WideCharToMultiByte(CP_UTF8, 0, Data, Count - 1, &str[0], size, nullptr, nullptr);
-		return str;
+		return Count > 0 ? Utf16ToUtf8(Data, Count - 1) : std::string();
 	}
 };
 
@@ -26,7 +26,17 @@ UEObject UEObject::GetOuter() const
 //---------------------------------------------------------------------------
 std::string UEObject::GetName() const
 {
-	return NamesStore().GetById(object->Name.Index);
+	return NamesStore().GetCachedById(object->Name.Index);
+}
+//---------------------------------------------------------------------------
+size_t UEObject::GetNameId() const
+{
+	return static_cast<size_t>(object->Name.Index);
+}
+//---------------------------------------------------------------------------
+bool UEObject::HasName(size_t nameId) const
+{
+	return static_cast<size_t>(object->Name.Index) == nameId;
 }
 //---------------------------------------------------------------------------
 UEClass UEObject::StaticClass()
@@ -57,7 +67,7 @@ std::vector<std::string> UEEnum::GetNames() const
 
 	for (auto i = 0u; i < names.Num(); ++i)
 	{
-		buffer.push_back(NamesStore().GetById(names[i].Index));
+		buffer.push_back(NamesStore().GetCachedById(names[i].Index));
 	}
 
 	return buffer;
@@ -120,6 +130,11 @@ UEFunctionFlags UEFunction::GetFunctionFlags() const
 	return static_cast<UEFunctionFlags>(static_cast<UFunction*>(object)->FunctionFlags);
 }
 //---------------------------------------------------------------------------
+size_t UEFunction::GetParmsSize() const
+{
+	return static_cast<UFunction*>(object)->ParmsSize;
+}
+//---------------------------------------------------------------------------
 UEClass UEFunction::StaticClass()
 {
 	static auto c = ObjectsStore().FindClass("Class Core.Function");
@@ -252,6 +267,11 @@ UEClass UEBoolProperty::StaticClass()
 //---------------------------------------------------------------------------
 //UEObjectProperty
 //---------------------------------------------------------------------------
+UEClass UEObjectProperty::GetPropertyClass() const
+{
+	return static_cast<UObjectProperty*>(object)->PropertyClass;
+}
+//---------------------------------------------------------------------------
 UEProperty::Info UEObjectProperty::GetInfo() const
 {
 	return Info::Create(PropertyType::Primitive, sizeof(void*), false, "class " + MakeValidName(UEClass(static_cast<UObjectProperty*>(object)->PropertyClass).GetNameCPP()) + "*");
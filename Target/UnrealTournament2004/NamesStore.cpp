@@ -2,6 +2,7 @@
 
 #include "PatternFinder.hpp"
 #include "NamesStore.hpp"
+#include "Utf8.hpp"
 
 #include "EngineClasses.hpp"
 
@@ -12,11 +13,7 @@ struct FNameEntry
 	
 	std::string GetName()
 	{
-		auto length = std::wcslen(Data);
-		auto neededLength = WideCharToMultiByte(CP_UTF8, 0, Data, length, nullptr, 0, nullptr, nullptr);
-		std::string str(neededLength, 0);
-		WideCharToMultiByte(CP_UTF8, 0, Data, length, &str[0], neededLength, nullptr, nullptr);
-		return str;
+		return Utf16ToUtf8(Data);
 	}
 };
 
@@ -1,7 +1,9 @@
 #include <windows.h>
+#include <cstddef>
 
 #include "PatternFinder.hpp"
 #include "NamesStore.hpp"
+#include "Utf8.hpp"
 
 #include "EngineClasses.hpp"
 
@@ -24,13 +26,7 @@ public:
 
 	std::string GetName() const
 	{
-		auto length = std::wcslen(WideName);
-
-		std::string str(length, '\0');
-
-		std::use_facet<std::ctype<wchar_t>>(std::locale()).narrow(WideName, WideName + length, '?', &str[0]);
-
-		return str;
+		return Utf16ToUtf8(WideName);
 	}
 };
 
@@ -49,6 +45,48 @@ bool NamesStore::Initialize()
 	return true;
 }
 
+bool NamesStore::Initialize(const std::vector<std::string>& names)
+{
+	static std::vector<uint64_t> storage;
+	static std::vector<FNameEntry*> entries;
+	static TArray<FNameEntry*> array;
+
+	//an entry only needs the space for its name
+	auto getEntrySize = [](const std::string& name)
+	{
+		auto size = offsetof(FNameEntry, WideName) + (name.length() + 1) * sizeof(wchar_t);
+		return (size + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+	};
+
+	size_t size = 0;
+	for (auto&& name : names)
+	{
+		size += getEntrySize(name);
+	}
+	storage.assign(size, 0);
+	entries.clear();
+
+	auto data = storage.data();
+	for (auto&& name : names)
+	{
+		auto entry = reinterpret_cast<FNameEntry*>(data);
+		entry->Index = static_cast<uint32_t>(entries.size());
+		for (auto i = 0u; i <= name.length(); ++i)
+		{
+			entry->WideName[i] = static_cast<unsigned char>(name.c_str()[i]);
+		}
+		entries.push_back(entry);
+
+		data += getEntrySize(name);
+	}
+
+	array = TArray<FNameEntry*>(entries.data(), entries.size());
+
+	GlobalNames = &array;
+
+	return true;
+}
+
 size_t NamesStore::GetNamesNum() const
 {
 	return GlobalNames->Num();
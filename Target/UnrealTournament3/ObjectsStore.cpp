@@ -20,6 +20,19 @@ bool ObjectsStore::Initialize()
 	return true;
 }
 
+bool ObjectsStore::Initialize(const std::vector<UObject*>& objects)
+{
+	static std::vector<UObject*> storage;
+	static TArray<UObject*> array;
+
+	storage = objects;
+	array = TArray<UObject*>(storage.data(), storage.size());
+
+	GlobalObjects = &array;
+
+	return true;
+}
+
 size_t ObjectsStore::GetObjectsNum() const
 {
 	return GlobalObjects->Num();
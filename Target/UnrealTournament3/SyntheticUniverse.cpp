@@ -0,0 +1,181 @@
+#include "SyntheticUniverse.hpp"
+#include "ObjectsStore.hpp"
+#include "NamesStore.hpp"
+
+#include "EngineClasses.hpp"
+
+const SyntheticUniverse::CoreLayout& SyntheticUniverse::GetCoreLayout()
+{
+	static const CoreLayout layout = {
+		"Core",
+		{
+			{ "Object", nullptr, sizeof(UObject) },
+			{ "Package", "Object", sizeof(UObject) },
+			{ "Field", "Object", sizeof(UField) },
+			{ "Enum", "Field", sizeof(UEnum) },
+			{ "Const", "Field", sizeof(UConst) },
+			{ "Struct", "Field", sizeof(UStruct) },
+			{ "ScriptStruct", "Struct", sizeof(UScriptStruct) },
+			{ "Function", "Struct", sizeof(UFunction) },
+			{ "State", "Struct", sizeof(UState) },
+			{ "Class", "State", sizeof(UClass) },
+			{ "Property", "Field", sizeof(UProperty) },
+			{ "ByteProperty", "Property", sizeof(UByteProperty) },
+			{ "IntProperty", "Property", sizeof(UIntProperty) },
+			{ "FloatProperty", "Property", sizeof(UFloatProperty) },
+			{ "BoolProperty", "Property", sizeof(UBoolProperty) },
+			{ "ObjectProperty", "Property", sizeof(UObjectProperty) },
+			{ "ComponentProperty", "ObjectProperty", sizeof(UComponentProperty) },
+			{ "ClassProperty", "ObjectProperty", sizeof(UClassProperty) },
+			{ "InterfaceProperty", "Property", sizeof(UInterfaceProperty) },
+			{ "NameProperty", "Property", sizeof(UNameProperty) },
+			{ "StructProperty", "Property", sizeof(UStructProperty) },
+			{ "StrProperty", "Property", sizeof(UStrProperty) },
+			{ "ArrayProperty", "Property", sizeof(UArrayProperty) },
+			{ "MapProperty", "Property", sizeof(UMapProperty) },
+			{ "DelegateProperty", "Property", sizeof(UDelegateProperty) }
+		}
+	};
+	return layout;
+}
+
+namespace
+{
+	UObject* CreateObject(const SyntheticUniverse::Object& description)
+	{
+		using ObjectType = SyntheticUniverse::ObjectType;
+		using PropertyType = SyntheticUniverse::PropertyType;
+
+		switch (description.Type)
+		{
+			case ObjectType::Class:
+				return new UClass();
+			case ObjectType::ScriptStruct:
+				return new UScriptStruct();
+			case ObjectType::Function:
+				return new UFunction();
+			case ObjectType::Enum:
+				return new UEnum();
+			case ObjectType::Property:
+				switch (description.Property)
+				{
+					case PropertyType::Byte:
+						return new UByteProperty();
+					case PropertyType::Bool:
+						return new UBoolProperty();
+					case PropertyType::Object:
+						return new UObjectProperty();
+					case PropertyType::Struct:
+						return new UStructProperty();
+					case PropertyType::Array:
+						return new UArrayProperty();
+					default:
+						return new UProperty();
+				}
+			default:
+				return new UObject();
+		}
+	}
+}
+
+bool SyntheticUniverse::Install() const
+{
+	std::vector<UObject*> engineObjects;
+	engineObjects.reserve(objects.size());
+	for (auto&& description : objects)
+	{
+		engineObjects.push_back(CreateObject(description));
+	}
+
+	auto get = [&engineObjects](uint32_t index) -> UObject*
+	{
+		return index != InvalidIndex ? engineObjects[index] : nullptr;
+	};
+
+	for (auto i = 0u; i < objects.size(); ++i)
+	{
+		auto& description = objects[i];
+		auto obj = engineObjects[i];
+
+		obj->InternalIndex = i;
+		obj->Outer = get(description.Outer);
+		obj->Name.Index = static_cast<int32_t>(description.Name);
+		obj->Name.Number = 0;
+		obj->Class = get(description.Class);
+
+		if (description.Type == ObjectType::Package)
+		{
+			continue;
+		}
+
+		auto field = static_cast<UField*>(obj);
+		field->Next = static_cast<UField*>(get(description.Next));
+
+		switch (description.Type)
+		{
+			case ObjectType::Class:
+			case ObjectType::ScriptStruct:
+			case ObjectType::Function:
+			{
+				auto structObj = static_cast<UStruct*>(obj);
+				structObj->SuperField = static_cast<UField*>(get(description.Super));
+				structObj->Children = static_cast<UField*>(get(description.Children));
+				structObj->PropertySize = description.Size;
+
+				if (description.Type == ObjectType::Function)
+				{
+					auto function = static_cast<UFunction*>(obj);
+					function->FunctionFlags = static_cast<uint32_t>(description.Flags);
+					function->ParmsSize = static_cast<uint16_t>(description.Size);
+				}
+				break;
+			}
+			case ObjectType::Enum:
+			{
+				auto values = new FName[description.ValueCount];
+				for (auto j = 0u; j < description.ValueCount; ++j)
+				{
+					values[j].Index = static_cast<int32_t>(enumValues[description.FirstValue + j]);
+					values[j].Number = 0;
+				}
+				static_cast<UEnum*>(obj)->Names = TArray<FName>(values, description.ValueCount);
+				break;
+			}
+			case ObjectType::Property:
+			{
+				auto property = static_cast<UProperty*>(obj);
+				property->ArrayDim = description.ArrayDim;
+				property->ElementSize = description.Size;
+				property->PropertyFlags = static_cast<uint32_t>(description.Flags);
+				property->Offset = description.Offset;
+
+				auto reference = get(description.Reference);
+				switch (description.Property)
+				{
+					case PropertyType::Byte:
+						static_cast<UByteProperty*>(obj)->Enum = static_cast<UEnum*>(reference);
+						break;
+					case PropertyType::Bool:
+						static_cast<UBoolProperty*>(obj)->BitMask = description.BitMask;
+						break;
+					case PropertyType::Object:
+						static_cast<UObjectProperty*>(obj)->PropertyClass = static_cast<UClass*>(reference);
+						break;
+					case PropertyType::Struct:
+						static_cast<UStructProperty*>(obj)->Struct = static_cast<UStruct*>(reference);
+						break;
+					case PropertyType::Array:
+						static_cast<UArrayProperty*>(obj)->Inner = static_cast<UProperty*>(reference);
+						break;
+					default:
+						break;
+				}
+				break;
+			}
+			default:
+				break;
+		}
+	}
+
+	return NamesStore::Initialize(names) && ObjectsStore::Initialize(engineObjects);
+}
@@ -4,6 +4,8 @@
 #include <string>
 #include <windows.h>
 
+#include "Utf8.hpp"
+
 struct FPointer
 {
 	uintptr_t Dummy;
@@ -33,6 +35,12 @@ public:
 		Count = Max = 0;
 	};
 
+	TArray(T* data, size_t count)
+	{
+		Data = data;
+		Count = Max = static_cast<int32_t>(count);
+	};
+
 	size_t Num() const
 	{
 		return Count;
@@ -71,10 +79,7 @@ struct FString : public TArray<wchar_t>
 {
 	std::string ToString() const
 	{
-		int size = WideCharToMultiByte(CP_UTF8, 0, Data, Count, nullptr, 0, nullptr, nullptr);
-		std::string str(size, 0);
-		WideCharToMultiByte(CP_UTF8, 0, Data, Count, &str[0], size, nullptr, nullptr);
-		return str;
+		return Utf16ToUtf8(Data, Count);
 	}
 };
 
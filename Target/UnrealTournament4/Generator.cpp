@@ -157,6 +157,18 @@ public:
 	{
 		return FindObject<UClass>(name);
 	})"),
+			PredefinedMethod::Default("void CallNativeFunction(class UFunction* function, void* native, void* parms, void* result)", R"(void UObject::CallNativeFunction(UFunction* function, void* native, void* parms, void* result)
+{
+	//the thunk reads its parameters through PropertyChainForCompiledIn because there is no bytecode
+	FFrame stack;
+	std::memset(&stack, 0, sizeof(FFrame));
+	stack.Node = function;
+	stack.Object = this;
+	stack.Locals = static_cast<uint8_t*>(parms);
+	stack.PropertyChainForCompiledIn = function->Children;
+
+	reinterpret_cast<void(*)(UObject*, FFrame&, void*)>(native)(this, stack, result);
+})"),
 			PredefinedMethod::Default("bool IsA(UClass* cmp) const", R"(bool UObject::IsA(UClass* cmp) const
 {
 	for (auto super = Class; super; super = (UClass*)super->SuperField)
@@ -286,6 +298,256 @@ public:
 	TUObjectArray ObjObjects;
 };
 
+struct FOutParmRec
+{
+	class UProperty* Property;
+	uint8_t* PropAddr;
+	FOutParmRec* NextOutParm;
+};
+
+struct FFrame
+{
+	void* VTable;
+	bool bSuppressEventTag;
+	bool bAutoEmitLineTerminator;
+	class UFunction* Node;
+	UObject* Object;
+	uint8_t* Code;
+	uint8_t* Locals;
+	class UProperty* MostRecentProperty;
+	uint8_t* MostRecentPropertyAddress;
+	unsigned char FlowStack[0x30];
+	FFrame* PreviousFrame;
+	FOutParmRec* OutParms;
+	class UField* PropertyChainForCompiledIn;
+	class UFunction* CurrentNativeFunction;
+};
+
+//Converts an UTF-16 string to UTF-8, ASCII characters are copied directly
+inline std::string Utf16ToUtf8(const wchar_t* str)
+{
+	auto length = std::wcslen(str);
+
+	std::string result;
+	result.reserve(length);
+
+	for (auto i = 0u; i < length; ++i)
+	{
+		uint32_t c = static_cast<uint16_t>(str[i]);
+		if (c < 0x80)
+		{
+			result += static_cast<char>(c);
+			continue;
+		}
+
+		if (c >= 0xD800 && c <= 0xDFFF)
+		{
+			if (c <= 0xDBFF && i + 1 < length && str[i + 1] >= 0xDC00 && str[i + 1] <= 0xDFFF)
+			{
+				c = 0x10000 + ((c - 0xD800) << 10) + (static_cast<uint16_t>(str[++i]) - 0xDC00);
+			}
+			else
+			{
+				c = 0xFFFD;
+			}
+		}
+
+		if (c < 0x800)
+		{
+			result += static_cast<char>(0xC0 | (c >> 6));
+		}
+		else if (c < 0x10000)
+		{
+			result += static_cast<char>(0xE0 | (c >> 12));
+			result += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+		}
+		else
+		{
+			result += static_cast<char>(0xF0 | (c >> 18));
+			result += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+			result += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+		}
+		result += static_cast<char>(0x80 | (c & 0x3F));
+	}
+
+	return result;
+}
+
+template<class T>
+class TObjectIterator
+{
+public:
+	inline explicit TObjectIterator(int32_t startIndex = 0)
+		: index(startIndex - 1),
+		  end(T::GetGlobalObjects().Num())
+	{
+		Advance();
+	}
+
+	static inline TObjectIterator End()
+	{
+		return TObjectIterator(EndTag());
+	}
+
+	inline int32_t GetIndex() const
+	{
+		return index;
+	}
+
+	inline T* operator*() const
+	{
+		return static_cast<T*>(T::GetGlobalObjects().GetByIndex(index));
+	}
+
+	inline T* operator->() const
+	{
+		return **this;
+	}
+
+	inline TObjectIterator& operator++()
+	{
+		Advance();
+		return *this;
+	}
+
+	//every finished iterator equals the end iterator, even if the game appended objects in between
+	inline bool operator==(const TObjectIterator& other) const
+	{
+		return index == other.index || (IsEnd() && other.IsEnd());
+	}
+
+	inline bool operator!=(const TObjectIterator& other) const
+	{
+		return !(*this == other);
+	}
+
+	explicit inline operator bool() const
+	{
+		return !IsEnd();
+	}
+
+	static inline bool IsLiveInstance(const FUObjectItem* item)
+	{
+		return item != nullptr
+			&& item->Object != nullptr
+			&& !item->IsPendingKill()
+			&& !item->IsUnreachable()
+			&& static_cast<T*>(item->Object)->IsA(T::StaticClass());
+	}
+
+private:
+	struct EndTag { };
+
+	inline explicit TObjectIterator(EndTag)
+		: index(T::GetGlobalObjects().Num()),
+		  end(index)
+	{
+	}
+
+	inline bool IsEnd() const
+	{
+		return index >= end;
+	}
+
+	//objects appended after the iterator was created are not visited
+	inline void Advance()
+	{
+		auto& objects = T::GetGlobalObjects();
+		for (++index; index < end; ++index)
+		{
+			if (IsLiveInstance(objects.GetItemByIndex(index)))
+			{
+				break;
+			}
+		}
+	}
+
+	int32_t index;
+	int32_t end;
+};
+
+template<class T>
+struct TObjectRange
+{
+	inline TObjectIterator<T> begin() const
+	{
+		return TObjectIterator<T>();
+	}
+
+	inline TObjectIterator<T> end() const
+	{
+		return TObjectIterator<T>::End();
+	}
+};
+
+//Caches all live instances of T. Every Update() only scans the object slots appended since the last call
+//and drops cached entries which are pending kill, unreachable or whose slot got reused.
+//Objects which get created in recycled slots below the scanned index are only found after Reset().
+template<class T>
+class TObjectInstanceCache
+{
+public:
+	inline TObjectInstanceCache()
+		: scannedIndex(0)
+	{
+	}
+
+	inline const std::vector<T*>& Update()
+	{
+		auto& objects = T::GetGlobalObjects();
+
+		size_t keep = 0;
+		for (size_t i = 0; i < entries.size(); ++i)
+		{
+			auto item = objects.GetItemByIndex(entries[i].Index);
+			if (item != nullptr && item->Object == entries[i].Object && !item->IsPendingKill() && !item->IsUnreachable())
+			{
+				entries[keep] = entries[i];
+				instances[keep] = entries[i].Object;
+				++keep;
+			}
+		}
+		entries.resize(keep);
+		instances.resize(keep);
+
+		for (auto num = objects.Num(); scannedIndex < num; ++scannedIndex)
+		{
+			auto item = objects.GetItemByIndex(scannedIndex);
+			if (TObjectIterator<T>::IsLiveInstance(item))
+			{
+				auto object = static_cast<T*>(item->Object);
+				entries.push_back({ scannedIndex, object });
+				instances.push_back(object);
+			}
+		}
+
+		return instances;
+	}
+
+	inline void Reset()
+	{
+		scannedIndex = 0;
+		entries.clear();
+		instances.clear();
+	}
+
+	inline const std::vector<T*>& GetInstances() const
+	{
+		return instances;
+	}
+
+private:
+	struct Entry
+	{
+		int32_t Index;
+		T* Object;
+	};
+
+	int32_t scannedIndex;
+	std::vector<Entry> entries;
+	std::vector<T*> instances;
+};
+
 template<class T>
 struct TArray
 {
@@ -371,6 +633,15 @@ public:
 	{
 		return WideName;
 	}
+
+	inline std::string GetName() const
+	{
+		if (IsWide())
+		{
+			return Utf16ToUtf8(WideName);
+		}
+		return AnsiName;
+	}
 };
 
 template<typename ElementType, int32_t MaxTotalElements, int32_t ElementsPerChunk>
@@ -477,9 +748,9 @@ struct FName
 		return *GNames;
 	};
 
-	inline const char* GetName() const
+	inline std::string GetName() const
 	{
-		return GetGlobalNames()[ComparisonIndex]->GetAnsiName();
+		return GetGlobalNames()[ComparisonIndex]->GetName();
 	};
 
 	inline bool operator==(const FName &other) const
@@ -516,13 +787,7 @@ struct FString : private TArray<wchar_t>
 
 	std::string ToString() const
 	{
-		auto length = std::wcslen(Data);
-
-		std::string str(length, '\0');
-
-		std::use_facet<std::ctype<wchar_t>>(std::locale()).narrow(Data, Data + length, '?', &str[0]);
-
-		return str;
+		return Utf16ToUtf8(Data);
 	}
 };
 
@@ -1,12 +1,18 @@
 #include <windows.h>
+#include <cstddef>
+#include <cstring>
 
 #include "PatternFinder.hpp"
 #include "NamesStore.hpp"
+#include "Utf8.hpp"
 
 #include "EngineClasses.hpp"
 
 class FNameEntry
 {
+	static const auto NAME_WIDE_MASK = 0x1;
+	static const auto NAME_INDEX_SHIFT = 1;
+
 public:
 	__int32 Index;
 	char pad_0x0004[0x4];
@@ -17,9 +23,21 @@ public:
 		wchar_t WideName[1024];
 	};
 
-	const char* GetName() const
+	inline bool IsWide() const
+	{
+		return Index & NAME_WIDE_MASK;
+	}
+
+	std::string GetName() const
 	{
-		return AnsiName;
+		if (IsWide())
+		{
+			return Utf16ToUtf8(WideName);
+		}
+		else
+		{
+			return AnsiName;
+		}
 	}
 };
 
@@ -42,6 +60,22 @@ public:
 		return *GetItemPtr(index);
 	}
 
+	/// <summary>
+	/// Adds an element. This is only used for names which were not created by the game.
+	/// </summary>
+	/// <param name="element">The element.</param>
+	void Add(ElementType* element)
+	{
+		auto chunkIndex = NumElements / ElementsPerChunk;
+		if (chunkIndex >= NumChunks)
+		{
+			Chunks[chunkIndex] = new ElementType*[ElementsPerChunk]();
+			NumChunks = chunkIndex + 1;
+		}
+		Chunks[chunkIndex][NumElements % ElementsPerChunk] = element;
+		++NumElements;
+	}
+
 private:
 	ElementType const* const* GetItemPtr(int32_t Index) const
 	{
@@ -78,6 +112,46 @@ bool NamesStore::Initialize()
 	return true;
 }
 
+bool NamesStore::Initialize(const std::vector<std::string>& names)
+{
+	static std::vector<uint64_t> storage;
+	static TNameEntryArray array;
+
+	if (names.size() > 2 * 1024 * 1024 || array.Num() != 0)
+	{
+		return false;
+	}
+
+	//an entry only needs the space for its name
+	auto getEntrySize = [](const std::string& name)
+	{
+		auto size = offsetof(FNameEntry, AnsiName) + name.length() + 1;
+		return (size + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+	};
+
+	size_t size = 0;
+	for (auto&& name : names)
+	{
+		size += getEntrySize(name);
+	}
+	storage.assign(size, 0);
+
+	auto data = storage.data();
+	for (auto&& name : names)
+	{
+		auto entry = reinterpret_cast<FNameEntry*>(data);
+		entry->Index = static_cast<__int32>(array.Num()) << 1; //not a wide name
+		std::memcpy(entry->AnsiName, name.c_str(), name.length() + 1);
+		array.Add(entry);
+
+		data += getEntrySize(name);
+	}
+
+	GlobalNames = &array;
+
+	return true;
+}
+
 size_t NamesStore::GetNamesNum() const
 {
 	return GlobalNames->Num();
@@ -48,6 +48,26 @@ bool ObjectsStore::Initialize()
 	return true;
 }
 
+bool ObjectsStore::Initialize(const std::vector<UObject*>& objects)
+{
+	static std::vector<FUObjectItem> items;
+	static FUObjectArray array;
+
+	items.assign(objects.size(), FUObjectItem());
+	for (auto i = 0u; i < objects.size(); ++i)
+	{
+		items[i].Object = objects[i];
+	}
+
+	array = FUObjectArray();
+	array.ObjObjects.Objects = items.data();
+	array.ObjObjects.MaxElements = array.ObjObjects.NumElements = static_cast<int32_t>(items.size());
+
+	GlobalObjects = &array;
+
+	return true;
+}
+
 size_t ObjectsStore::GetObjectsNum() const
 {
 	return GlobalObjects->ObjObjects.NumElements;
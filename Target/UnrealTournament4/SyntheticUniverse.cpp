@@ -0,0 +1,195 @@
+#include "SyntheticUniverse.hpp"
+#include "ObjectsStore.hpp"
+#include "NamesStore.hpp"
+
+#include "EngineClasses.hpp"
+
+const SyntheticUniverse::CoreLayout& SyntheticUniverse::GetCoreLayout()
+{
+	static const CoreLayout layout = {
+		"CoreUObject",
+		{
+			{ "Object", nullptr, sizeof(UObject) },
+			{ "Package", "Object", sizeof(UObject) },
+			{ "Field", "Object", sizeof(UField) },
+			{ "Enum", "Field", sizeof(UEnum) },
+			{ "Struct", "Field", sizeof(UStruct) },
+			{ "ScriptStruct", "Struct", sizeof(UScriptStruct) },
+			{ "Function", "Struct", sizeof(UFunction) },
+			{ "Class", "Struct", sizeof(UClass) },
+			{ "Property", "Field", sizeof(UProperty) },
+			{ "NumericProperty", "Property", sizeof(UNumericProperty) },
+			{ "ByteProperty", "NumericProperty", sizeof(UByteProperty) },
+			{ "UInt16Property", "NumericProperty", sizeof(UUInt16Property) },
+			{ "UInt32Property", "NumericProperty", sizeof(UUInt32Property) },
+			{ "UInt64Property", "NumericProperty", sizeof(UUInt64Property) },
+			{ "Int8Property", "NumericProperty", sizeof(UInt8Property) },
+			{ "Int16Property", "NumericProperty", sizeof(UInt16Property) },
+			{ "IntProperty", "NumericProperty", sizeof(UIntProperty) },
+			{ "Int64Property", "NumericProperty", sizeof(UInt64Property) },
+			{ "FloatProperty", "NumericProperty", sizeof(UFloatProperty) },
+			{ "DoubleProperty", "NumericProperty", sizeof(UDoubleProperty) },
+			{ "BoolProperty", "Property", sizeof(UBoolProperty) },
+			{ "ObjectPropertyBase", "Property", sizeof(UObjectPropertyBase) },
+			{ "ObjectProperty", "ObjectPropertyBase", sizeof(UObjectProperty) },
+			{ "ClassProperty", "ObjectProperty", sizeof(UClassProperty) },
+			{ "InterfaceProperty", "Property", sizeof(UInterfaceProperty) },
+			{ "WeakObjectProperty", "ObjectPropertyBase", sizeof(UWeakObjectProperty) },
+			{ "LazyObjectProperty", "ObjectPropertyBase", sizeof(ULazyObjectProperty) },
+			{ "AssetObjectProperty", "ObjectPropertyBase", sizeof(UAssetObjectProperty) },
+			{ "AssetClassProperty", "AssetObjectProperty", sizeof(UAssetClassProperty) },
+			{ "NameProperty", "Property", sizeof(UNameProperty) },
+			{ "StructProperty", "Property", sizeof(UStructProperty) },
+			{ "StrProperty", "Property", sizeof(UStrProperty) },
+			{ "TextProperty", "Property", sizeof(UTextProperty) },
+			{ "ArrayProperty", "Property", sizeof(UArrayProperty) },
+			{ "MapProperty", "Property", sizeof(UMapProperty) },
+			{ "DelegateProperty", "Property", sizeof(UDelegateProperty) },
+			{ "MulticastDelegateProperty", "Property", sizeof(UMulticastDelegateProperty) }
+		}
+	};
+	return layout;
+}
+
+namespace
+{
+	UObject* CreateObject(const SyntheticUniverse::Object& description)
+	{
+		using ObjectType = SyntheticUniverse::ObjectType;
+		using PropertyType = SyntheticUniverse::PropertyType;
+
+		switch (description.Type)
+		{
+			case ObjectType::Class:
+				return new UClass();
+			case ObjectType::ScriptStruct:
+				return new UScriptStruct();
+			case ObjectType::Function:
+				return new UFunction();
+			case ObjectType::Enum:
+				return new UEnum();
+			case ObjectType::Property:
+				switch (description.Property)
+				{
+					case PropertyType::Byte:
+						return new UByteProperty();
+					case PropertyType::Bool:
+						return new UBoolProperty();
+					case PropertyType::Object:
+						return new UObjectProperty();
+					case PropertyType::Struct:
+						return new UStructProperty();
+					case PropertyType::Array:
+						return new UArrayProperty();
+					default:
+						return new UProperty();
+				}
+			default:
+				return new UObject();
+		}
+	}
+}
+
+bool SyntheticUniverse::Install() const
+{
+	std::vector<UObject*> engineObjects;
+	engineObjects.reserve(objects.size());
+	for (auto&& description : objects)
+	{
+		engineObjects.push_back(CreateObject(description));
+	}
+
+	auto get = [&engineObjects](uint32_t index) -> UObject*
+	{
+		return index != InvalidIndex ? engineObjects[index] : nullptr;
+	};
+
+	for (auto i = 0u; i < objects.size(); ++i)
+	{
+		auto& description = objects[i];
+		auto obj = engineObjects[i];
+
+		obj->InternalIndex = static_cast<int32_t>(i);
+		obj->Class = static_cast<UClass*>(get(description.Class));
+		obj->Name.ComparisonIndex = static_cast<int32_t>(description.Name);
+		obj->Name.Number = 0;
+		obj->Outer = get(description.Outer);
+
+		if (description.Type == ObjectType::Package)
+		{
+			continue;
+		}
+
+		auto field = static_cast<UField*>(obj);
+		field->Next = static_cast<UField*>(get(description.Next));
+
+		switch (description.Type)
+		{
+			case ObjectType::Class:
+			case ObjectType::ScriptStruct:
+			case ObjectType::Function:
+			{
+				auto structObj = static_cast<UStruct*>(obj);
+				structObj->SuperField = static_cast<UStruct*>(get(description.Super));
+				structObj->Children = static_cast<UField*>(get(description.Children));
+				structObj->PropertySize = static_cast<int32_t>(description.Size);
+
+				if (description.Type == ObjectType::Function)
+				{
+					auto function = static_cast<UFunction*>(obj);
+					function->FunctionFlags = static_cast<int32_t>(description.Flags);
+					function->ParmsSize = static_cast<int16_t>(description.Size);
+				}
+				break;
+			}
+			case ObjectType::Enum:
+			{
+				auto values = new TPair<FName, uint64_t>[description.ValueCount];
+				for (auto j = 0u; j < description.ValueCount; ++j)
+				{
+					values[j].Key.ComparisonIndex = static_cast<int32_t>(enumValues[description.FirstValue + j]);
+					values[j].Key.Number = 0;
+					values[j].Value = j;
+				}
+				static_cast<UEnum*>(obj)->Names = TArray<TPair<FName, uint64_t>>(values, description.ValueCount);
+				break;
+			}
+			case ObjectType::Property:
+			{
+				auto property = static_cast<UProperty*>(obj);
+				property->ArrayDim = static_cast<int32_t>(description.ArrayDim);
+				property->ElementSize = static_cast<int32_t>(description.Size);
+				property->PropertyFlags.A = static_cast<int>(description.Flags);
+				property->PropertyFlags.B = static_cast<int>(description.Flags >> 32);
+				property->Offset = static_cast<int32_t>(description.Offset);
+
+				auto reference = get(description.Reference);
+				switch (description.Property)
+				{
+					case PropertyType::Byte:
+						static_cast<UByteProperty*>(obj)->Enum = static_cast<UEnum*>(reference);
+						break;
+					case PropertyType::Bool:
+						static_cast<UBoolProperty*>(obj)->BitMask = description.BitMask;
+						break;
+					case PropertyType::Object:
+						static_cast<UObjectProperty*>(obj)->PropertyClass = static_cast<UClass*>(reference);
+						break;
+					case PropertyType::Struct:
+						static_cast<UStructProperty*>(obj)->Struct = static_cast<UScriptStruct*>(reference);
+						break;
+					case PropertyType::Array:
+						static_cast<UArrayProperty*>(obj)->Inner = static_cast<UProperty*>(reference);
+						break;
+					default:
+						break;
+				}
+				break;
+			}
+			default:
+				break;
+		}
+	}
+
+	return NamesStore::Initialize(names) && ObjectsStore::Initialize(engineObjects);
+}